@@ -0,0 +1,73 @@
+// Package bridge provides the CGO bridge between the C++ native plugin and Go runtime.
+// This file contains the scratch arenas used to pass Go strings to C++.
+package bridge
+
+/*
+#include <stdlib.h>
+*/
+import "C"
+import (
+	"unsafe"
+)
+
+// cArenaSize is the C memory behind one arena. Strings that do not fit fall
+// back to C.CString, so the size only bounds the fast path.
+const cArenaSize = 4096
+
+// cArenaPoolSize bounds how many idle arenas are kept for reuse
+const cArenaPoolSize = 16
+
+// cArena bump-allocates NUL-terminated copies of Go strings in one long-lived
+// malloc'd block. A wrapper takes an arena for the duration of a native call
+// and releases it afterwards, so string arguments cost a memcpy instead of a
+// malloc/free pair each. Native code must not keep the pointers past the call.
+type cArena struct {
+	base     unsafe.Pointer
+	used     int
+	overflow []unsafe.Pointer // C.CString fallbacks, freed on release
+}
+
+// Idle arenas. Taking one from or returning one to the channel does not
+// allocate, and is safe for wrappers called from any goroutine.
+var cArenas = make(chan *cArena, cArenaPoolSize)
+
+// getArena returns an empty arena, reusing an idle one when available
+func getArena() *cArena {
+	select {
+	case a := <-cArenas:
+		return a
+	default:
+		return &cArena{base: C.malloc(cArenaSize)}
+	}
+}
+
+// release frees fallback strings and returns the arena to the pool
+func (a *cArena) release() {
+	for _, p := range a.overflow {
+		C.free(p)
+	}
+	a.overflow = a.overflow[:0]
+	a.used = 0
+
+	select {
+	case cArenas <- a:
+	default:
+		C.free(a.base)
+	}
+}
+
+// str copies s into the arena as a C string, valid until release
+func (a *cArena) str(s string) *C.char {
+	n := len(s) + 1
+	if a.used+n > cArenaSize {
+		c := C.CString(s)
+		a.overflow = append(a.overflow, unsafe.Pointer(c))
+		return c
+	}
+	p := unsafe.Add(a.base, a.used)
+	buf := unsafe.Slice((*byte)(p), n)
+	copy(buf, s)
+	buf[len(s)] = 0
+	a.used += n
+	return (*C.char)(p)
+}
@@ -0,0 +1,136 @@
+package bridge
+
+import (
+	"strings"
+	"testing"
+	"unsafe"
+)
+
+// cStringAt reads the NUL-terminated string at p
+func cStringAt(p unsafe.Pointer) string {
+	var b strings.Builder
+	for i := 0; ; i++ {
+		c := *(*byte)(unsafe.Add(p, i))
+		if c == 0 {
+			return b.String()
+		}
+		b.WriteByte(c)
+	}
+}
+
+// drainArenas empties the idle pool so a test starts from a known state.
+// The drained arenas are released again when the test ends.
+func drainArenas(t *testing.T) {
+	t.Helper()
+	var idle []*cArena
+	for len(cArenas) > 0 {
+		idle = append(idle, <-cArenas)
+	}
+	t.Cleanup(func() {
+		for _, a := range idle {
+			a.release()
+		}
+	})
+}
+
+// ── arena tests ───────────────────────────────────────────────
+
+func TestArenaStrCopiesTerminatedStrings(t *testing.T) {
+	drainArenas(t)
+	a := getArena()
+	defer a.release()
+
+	inputs := []string{"weapon_ak47", "", "OnPressed", "ünïcødé"}
+	ptrs := make([]unsafe.Pointer, len(inputs))
+	for i, s := range inputs {
+		ptrs[i] = unsafe.Pointer(a.str(s))
+	}
+	// Later copies must not overwrite earlier ones
+	for i, s := range inputs {
+		if got := cStringAt(ptrs[i]); got != s {
+			t.Errorf("str(%q) reads back %q", s, got)
+		}
+	}
+
+	want := 0
+	for _, s := range inputs {
+		want += len(s) + 1
+	}
+	if a.used != want {
+		t.Fatalf("used = %d, want %d", a.used, want)
+	}
+	if len(a.overflow) != 0 {
+		t.Fatalf("small strings fell back to C.CString %d times", len(a.overflow))
+	}
+}
+
+func TestArenaOverflowFallsBack(t *testing.T) {
+	drainArenas(t)
+	a := getArena()
+
+	big := strings.Repeat("x", cArenaSize)
+	small := a.str("before")
+	p := a.str(big) // needs cArenaSize+1 bytes: cannot fit
+	after := a.str("after")
+
+	if got := cStringAt(unsafe.Pointer(p)); got != big {
+		t.Fatalf("overflowed string reads back %d bytes, want %d", len(got), len(big))
+	}
+	if len(a.overflow) != 1 {
+		t.Fatalf("overflow entries = %d, want 1", len(a.overflow))
+	}
+	if cStringAt(unsafe.Pointer(small)) != "before" || cStringAt(unsafe.Pointer(after)) != "after" {
+		t.Fatal("arena strings around an overflow were corrupted")
+	}
+
+	a.release()
+	if len(a.overflow) != 0 || a.used != 0 {
+		t.Fatalf("release left used=%d overflow=%d", a.used, len(a.overflow))
+	}
+}
+
+func TestArenaFillsExactly(t *testing.T) {
+	drainArenas(t)
+	a := getArena()
+	defer a.release()
+
+	a.str(strings.Repeat("y", cArenaSize-1)) // with the NUL: exactly full
+	if a.used != cArenaSize || len(a.overflow) != 0 {
+		t.Fatalf("exact fit: used=%d overflow=%d", a.used, len(a.overflow))
+	}
+	a.str("")
+	if len(a.overflow) != 1 {
+		t.Fatalf("full arena did not fall back: overflow=%d", len(a.overflow))
+	}
+}
+
+func TestArenaReleaseReuses(t *testing.T) {
+	drainArenas(t)
+	a := getArena()
+	base := a.base
+	a.str("hello")
+	a.release()
+
+	b := getArena()
+	defer b.release()
+	if b != a || b.base != base {
+		t.Fatal("released arena was not reused")
+	}
+	if b.used != 0 {
+		t.Fatalf("reused arena starts at used=%d", b.used)
+	}
+}
+
+func TestArenaPoolIsBounded(t *testing.T) {
+	drainArenas(t)
+	arenas := make([]*cArena, cArenaPoolSize+4)
+	for i := range arenas {
+		arenas[i] = getArena()
+	}
+	for _, a := range arenas {
+		a.release()
+	}
+	if n := len(cArenas); n != cArenaPoolSize {
+		t.Fatalf("idle arenas = %d, want %d", n, cArenaPoolSize)
+	}
+}
@@ -329,10 +329,212 @@ static inline void call_give_named_item(gs_callbacks_t* cb, int32_t slot, const
 static inline void call_player_drop_weapons(gs_callbacks_t* cb, int32_t slot) {
     if (cb && cb->player_drop_weapons) { cb->player_drop_weapons(slot); }
 }
+
+// === V6 Callback Helpers (Batched Native Subsystems) ===
+
+// Entity queries
+static inline int32_t call_find_entities_by_classname(gs_callbacks_t* cb, const char* classname, bool prefix, gs_entity_ref_t* out, int32_t max_out) {
+    if (cb && cb->find_entities_by_classname) { return cb->find_entities_by_classname(classname, prefix, out, max_out); }
+    return 0;
+}
+
+static inline uint32_t call_get_entity_handle(gs_callbacks_t* cb, uintptr_t entity) {
+    if (cb && cb->get_entity_handle) { return cb->get_entity_handle((void*)entity); }
+    return GS_INVALID_HANDLE;
+}
+
+// Entity spawning
+static inline int32_t call_spawn_entities(gs_callbacks_t* cb, const gs_spawn_spec_t* specs, int32_t count, gs_entity_ref_t* out) {
+    if (cb && cb->spawn_entities) { return cb->spawn_entities(specs, count, out); }
+    return 0;
+}
+
+static inline int32_t call_remove_entities(gs_callbacks_t* cb, const uint32_t* handles, int32_t count) {
+    if (cb && cb->remove_entities) { return cb->remove_entities(handles, count); }
+    return 0;
+}
+
+static inline int32_t call_fire_inputs(gs_callbacks_t* cb, const gs_input_req_t* reqs, int32_t count) {
+    if (cb && cb->fire_inputs) { return cb->fire_inputs(reqs, count); }
+    return 0;
+}
+
+static inline void call_subscribe_entity_output(gs_callbacks_t* cb, uint32_t handle, const char* output, bool enable) {
+    if (cb && cb->subscribe_entity_output) { cb->subscribe_entity_output(handle, output, enable); }
+}
+
+static inline void call_subscribe_trigger_touch(gs_callbacks_t* cb, uint32_t handle, bool enable) {
+    if (cb && cb->subscribe_trigger_touch) { cb->subscribe_trigger_touch(handle, enable); }
+}
+
+static inline void call_transmit_set_hidden(gs_callbacks_t* cb, int32_t slot, const uint32_t* indices, int32_t count, bool hidden) {
+    if (cb && cb->transmit_set_hidden) { cb->transmit_set_hidden(slot, indices, count, hidden); }
+}
+
+static inline void call_transmit_clear(gs_callbacks_t* cb, int32_t slot) {
+    if (cb && cb->transmit_clear) { cb->transmit_clear(slot); }
+}
+
+static inline void call_visibility_configure(gs_callbacks_t* cb, const gs_visibility_config_t* config) {
+    if (cb && cb->visibility_configure) { cb->visibility_configure(config); }
+}
+
+static inline int32_t call_visibility_get_matrix(gs_callbacks_t* cb, uint64_t* out_rows) {
+    if (cb && cb->visibility_get_matrix) { return cb->visibility_get_matrix(out_rows); }
+    return 0;
+}
+
+static inline int32_t call_trace_batch(gs_callbacks_t* cb, const gs_ray_t* rays, int32_t n, uint64_t mask, uint32_t flags, gs_trace_result_t* out) {
+    if (cb && cb->trace_batch) { return cb->trace_batch(rays, n, mask, flags, out); }
+    return 0;
+}
+
+static inline bool call_trace_available(gs_callbacks_t* cb) {
+    if (cb && cb->trace_available) { return cb->trace_available(); }
+    return false;
+}
+
+static inline int32_t call_player_ops_submit(gs_callbacks_t* cb, const gs_player_op_t* ops, int32_t n) {
+    if (cb && cb->player_ops_submit) { return cb->player_ops_submit(ops, n); }
+    return 0;
+}
+
+static inline int32_t call_weapon_list(gs_callbacks_t* cb, gs_weapon_info_t* out, int32_t max) {
+    if (cb && cb->weapon_list) { return cb->weapon_list(out, max); }
+    return 0;
+}
+
+static inline int32_t call_give_items(gs_callbacks_t* cb, int32_t slot, const int32_t* ids, int32_t n) {
+    if (cb && cb->give_items) { return cb->give_items(slot, ids, n); }
+    return 0;
+}
+
+static inline void call_item_rules_set(gs_callbacks_t* cb, int32_t rule, int32_t target, const int32_t* ids, int32_t n, bool enable) {
+    if (cb && cb->item_rules_set) { cb->item_rules_set(rule, target, ids, n, enable); }
+}
+
+static inline void call_item_set_limit(gs_callbacks_t* cb, int32_t team, int32_t item_id, int32_t limit) {
+    if (cb && cb->item_set_limit) { cb->item_set_limit(team, item_id, limit); }
+}
+
+static inline void call_item_set_count(gs_callbacks_t* cb, int32_t team, int32_t item_id, int32_t count) {
+    if (cb && cb->item_set_count) { cb->item_set_count(team, item_id, count); }
+}
+
+static inline void call_item_rules_clear(gs_callbacks_t* cb) {
+    if (cb && cb->item_rules_clear) { cb->item_rules_clear(); }
+}
+
+static inline int32_t call_hook_define(gs_callbacks_t* cb, const char* name, int32_t ret_type, const int32_t* arg_types, int32_t argc) {
+    if (cb && cb->hook_define) { return cb->hook_define(name, ret_type, arg_types, argc); }
+    return -1;
+}
+
+static inline void call_hook_subscribe(gs_callbacks_t* cb, int32_t hook_id, bool post, bool enable) {
+    if (cb && cb->hook_subscribe) { cb->hook_subscribe(hook_id, post, enable); }
+}
+
+static inline int32_t call_call_define(gs_callbacks_t* cb, const char* name, int32_t vtable_index, int32_t ret_type, const int32_t* arg_types, int32_t argc) {
+    if (cb && cb->call_define) { return cb->call_define(name, vtable_index, ret_type, arg_types, argc); }
+    return -1;
+}
+
+static inline bool call_call_invoke(gs_callbacks_t* cb, int32_t call_id, const uint64_t* args, const gs_vector3_t* vectors, uint64_t* ret) {
+    if (cb && cb->call_invoke) { return cb->call_invoke(call_id, args, vectors, ret); }
+    return false;
+}
+
+static inline const gs_gamerules_t* call_get_gamerules(gs_callbacks_t* cb) {
+    if (cb && cb->get_gamerules) { return cb->get_gamerules(); }
+    return NULL;
+}
+
+static inline bool call_terminate_round(gs_callbacks_t* cb, float delay, int32_t reason) {
+    if (cb && cb->terminate_round) { return cb->terminate_round(delay, reason); }
+    return false;
+}
+
+static inline void call_input_capture(gs_callbacks_t* cb, bool enable) {
+    if (cb && cb->input_capture) { cb->input_capture(enable); }
+}
+
+static inline int32_t call_history_query(gs_callbacks_t* cb, const int32_t* slots, int32_t count, float tick, gs_player_sample_t* out) {
+    if (cb && cb->history_query) { return cb->history_query(slots, count, tick, out); }
+    return 0;
+}
+
+static inline int32_t call_history_latest_tick(gs_callbacks_t* cb) {
+    if (cb && cb->history_latest_tick) { return cb->history_latest_tick(); }
+    return -1;
+}
+
+static inline int32_t call_watch_add(gs_callbacks_t* cb, uint32_t entity_handle, const char* class_name, const char* field_name, int32_t size) {
+    if (cb && cb->watch_add) { return cb->watch_add(entity_handle, class_name, field_name, size); }
+    return -1;
+}
+
+static inline void call_watch_remove(gs_callbacks_t* cb, int32_t watch_id) {
+    if (cb && cb->watch_remove) { cb->watch_remove(watch_id); }
+}
+
+static inline int32_t call_path_compile(gs_callbacks_t* cb, const char* path) {
+    if (cb && cb->path_compile) { return cb->path_compile(path); }
+    return -1;
+}
+
+static inline int32_t call_path_read(gs_callbacks_t* cb, int32_t path_id, const uint32_t* handles, int32_t count, int32_t size, uint8_t* out, bool* valid) {
+    if (cb && cb->path_read) { return cb->path_read(path_id, handles, count, size, out, valid); }
+    return 0;
+}
+
+static inline int32_t call_entity_read_array(gs_callbacks_t* cb, uintptr_t entity, const char* class_name, const char* field_name, int32_t kind, int32_t length, int32_t elem_size, void* out, int32_t max_count) {
+    if (cb && cb->entity_read_array) { return cb->entity_read_array((void*)entity, class_name, field_name, kind, length, elem_size, out, max_count); }
+    return -1;
+}
+
+static inline int32_t call_entity_read_handles(gs_callbacks_t* cb, uintptr_t entity, const char* class_name, const char* field_name, int32_t kind, int32_t length, gs_entity_ref_t* out, int32_t max_count) {
+    if (cb && cb->entity_read_handles) { return cb->entity_read_handles((void*)entity, class_name, field_name, kind, length, out, max_count); }
+    return -1;
+}
+
+static inline const char* call_string_get(gs_callbacks_t* cb, uint32_t id) {
+    if (cb && cb->string_get) { return cb->string_get(id); }
+    return NULL;
+}
+
+static inline uint32_t call_entity_classname_id(gs_callbacks_t* cb, uintptr_t entity) {
+    if (cb && cb->entity_classname_id) { return cb->entity_classname_id((void*)entity); }
+    return 0;
+}
+
+static inline uintptr_t gamerules_ptr(const gs_gamerules_t* state) {
+    return (uintptr_t)state->gamerules;
+}
+
+static inline gs_vector3_t read_vector(uintptr_t ptr) {
+    return *(const gs_vector3_t*)ptr;
+}
+
+static inline void write_vector(uintptr_t ptr, gs_vector3_t v) {
+    *(gs_vector3_t*)ptr = v;
+}
+
+static inline uintptr_t weapon_info_vdata(gs_weapon_info_t* info) {
+    return (uintptr_t)info->vdata;
+}
+
+static inline uintptr_t entity_ref_ptr(gs_entity_ref_t* ref) {
+    return (uintptr_t)ref->entity;
+}
+
+static inline uintptr_t entity_ref_classname(gs_entity_ref_t* ref) {
+    return (uintptr_t)ref->classname;
+}
 */
 import "C"
 import (
 	"fmt"
+	"sync"
 	"unsafe"
 )
 
@@ -348,10 +550,10 @@ func Log(level int, tag, message string) {
 		return
 	}
 
-	cTag := C.CString(tag)
-	cMsg := C.CString(message)
-	defer C.free(unsafe.Pointer(cTag))
-	defer C.free(unsafe.Pointer(cMsg))
+	arg := getArena()
+	defer arg.release()
+	cTag := arg.str(tag)
+	cMsg := arg.str(message)
 
 	C.call_log(callbacks, C.int(level), cTag, cMsg)
 }
@@ -386,8 +588,9 @@ func ExecuteServerCommand(cmd string) {
 		return
 	}
 
-	cCmd := C.CString(cmd)
-	defer C.free(unsafe.Pointer(cCmd))
+	arg := getArena()
+	defer arg.release()
+	cCmd := arg.str(cmd)
 
 	C.call_exec_command(callbacks, cCmd)
 }
@@ -399,8 +602,9 @@ func ReplyToCommand(slot int, message string) {
 		return
 	}
 
-	cMsg := C.CString(message)
-	defer C.free(unsafe.Pointer(cMsg))
+	arg := getArena()
+	defer arg.release()
+	cMsg := arg.str(message)
 
 	C.call_reply(callbacks, C.int32_t(slot), cMsg)
 }
@@ -461,6 +665,7 @@ func GetPlayer(slot int) *PlayerInfo {
 	if cPlayer.name != nil {
 		player.Name = C.GoString(cPlayer.name)
 	}
+
 	if cPlayer.ip != nil {
 		player.IP = C.GoString(cPlayer.ip)
 	}
@@ -519,8 +724,9 @@ func KickPlayer(slot int, reason string) {
 		return
 	}
 
-	cReason := C.CString(reason)
-	defer C.free(unsafe.Pointer(cReason))
+	arg := getArena()
+	defer arg.release()
+	cReason := arg.str(reason)
 
 	C.call_kick_player(callbacks, C.int32_t(slot), cReason)
 }
@@ -569,8 +775,9 @@ func SendChat(slot int, message string) {
 		return
 	}
 
-	cMsg := C.CString(message)
-	defer C.free(unsafe.Pointer(cMsg))
+	arg := getArena()
+	defer arg.release()
+	cMsg := arg.str(message)
 
 	C.call_send_chat(callbacks, C.int32_t(slot), cMsg)
 }
@@ -596,8 +803,9 @@ func SendCenter(slot int, message string) {
 		return
 	}
 
-	cMsg := C.CString(message)
-	defer C.free(unsafe.Pointer(cMsg))
+	arg := getArena()
+	defer arg.release()
+	cMsg := arg.str(message)
 
 	C.call_send_center(callbacks, C.int32_t(slot), cMsg)
 }
@@ -627,10 +835,10 @@ func SchemaGetOffset(className, fieldName string) (int32, bool) {
 		return 0, false
 	}
 
-	cClass := C.CString(className)
-	cField := C.CString(fieldName)
-	defer C.free(unsafe.Pointer(cClass))
-	defer C.free(unsafe.Pointer(cField))
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
 
 	var networked C.bool
 	offset := C.call_schema_get_offset(callbacks, cClass, cField, &networked)
@@ -643,10 +851,10 @@ func SchemaSetStateChanged(entityPtr uintptr, className, fieldName string, offse
 		return
 	}
 
-	cClass := C.CString(className)
-	cField := C.CString(fieldName)
-	defer C.free(unsafe.Pointer(cClass))
-	defer C.free(unsafe.Pointer(cField))
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
 
 	C.call_schema_set_state_changed(callbacks, C.uintptr_t(entityPtr), cClass, cField, C.int32_t(offset))
 }
@@ -661,10 +869,10 @@ func EntityGetInt(entityPtr uintptr, className, fieldName string) int32 {
 		return 0
 	}
 
-	cClass := C.CString(className)
-	cField := C.CString(fieldName)
-	defer C.free(unsafe.Pointer(cClass))
-	defer C.free(unsafe.Pointer(cField))
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
 
 	return int32(C.call_entity_get_int(callbacks, C.uintptr_t(entityPtr), cClass, cField))
 }
@@ -675,10 +883,10 @@ func EntitySetInt(entityPtr uintptr, className, fieldName string, value int32) {
 		return
 	}
 
-	cClass := C.CString(className)
-	cField := C.CString(fieldName)
-	defer C.free(unsafe.Pointer(cClass))
-	defer C.free(unsafe.Pointer(cField))
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
 
 	C.call_entity_set_int(callbacks, C.uintptr_t(entityPtr), cClass, cField, C.int32_t(value))
 }
@@ -689,10 +897,10 @@ func EntityGetFloat(entityPtr uintptr, className, fieldName string) float32 {
 		return 0
 	}
 
-	cClass := C.CString(className)
-	cField := C.CString(fieldName)
-	defer C.free(unsafe.Pointer(cClass))
-	defer C.free(unsafe.Pointer(cField))
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
 
 	return float32(C.call_entity_get_float(callbacks, C.uintptr_t(entityPtr), cClass, cField))
 }
@@ -703,10 +911,10 @@ func EntitySetFloat(entityPtr uintptr, className, fieldName string, value float3
 		return
 	}
 
-	cClass := C.CString(className)
-	cField := C.CString(fieldName)
-	defer C.free(unsafe.Pointer(cClass))
-	defer C.free(unsafe.Pointer(cField))
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
 
 	C.call_entity_set_float(callbacks, C.uintptr_t(entityPtr), cClass, cField, C.float(value))
 }
@@ -717,10 +925,10 @@ func EntityGetBool(entityPtr uintptr, className, fieldName string) bool {
 		return false
 	}
 
-	cClass := C.CString(className)
-	cField := C.CString(fieldName)
-	defer C.free(unsafe.Pointer(cClass))
-	defer C.free(unsafe.Pointer(cField))
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
 
 	return bool(C.call_entity_get_bool(callbacks, C.uintptr_t(entityPtr), cClass, cField))
 }
@@ -731,10 +939,10 @@ func EntitySetBool(entityPtr uintptr, className, fieldName string, value bool) {
 		return
 	}
 
-	cClass := C.CString(className)
-	cField := C.CString(fieldName)
-	defer C.free(unsafe.Pointer(cClass))
-	defer C.free(unsafe.Pointer(cField))
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
 
 	C.call_entity_set_bool(callbacks, C.uintptr_t(entityPtr), cClass, cField, C.bool(value))
 }
@@ -745,10 +953,10 @@ func EntityGetString(entityPtr uintptr, className, fieldName string) string {
 		return ""
 	}
 
-	cClass := C.CString(className)
-	cField := C.CString(fieldName)
-	defer C.free(unsafe.Pointer(cClass))
-	defer C.free(unsafe.Pointer(cField))
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
 
 	var buf [1024]C.char
 	length := C.call_entity_get_string(callbacks, C.uintptr_t(entityPtr), cClass, cField, &buf[0], 1024)
@@ -764,10 +972,10 @@ func EntityGetVector(entityPtr uintptr, className, fieldName string) (float32, f
 		return 0, 0, 0
 	}
 
-	cClass := C.CString(className)
-	cField := C.CString(fieldName)
-	defer C.free(unsafe.Pointer(cClass))
-	defer C.free(unsafe.Pointer(cField))
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
 
 	var vec C.gs_vector3_t
 	C.call_entity_get_vector(callbacks, C.uintptr_t(entityPtr), cClass, cField, &vec)
@@ -780,10 +988,10 @@ func EntitySetVector(entityPtr uintptr, className, fieldName string, x, y, z flo
 		return
 	}
 
-	cClass := C.CString(className)
-	cField := C.CString(fieldName)
-	defer C.free(unsafe.Pointer(cClass))
-	defer C.free(unsafe.Pointer(cField))
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
 
 	vec := C.gs_vector3_t{x: C.float(x), y: C.float(y), z: C.float(z)}
 	C.call_entity_set_vector(callbacks, C.uintptr_t(entityPtr), cClass, cField, &vec)
@@ -816,11 +1024,7 @@ func GetEntityClassname(entityPtr uintptr) string {
 	if callbacks == nil {
 		return ""
 	}
-	cName := C.call_get_entity_classname(callbacks, C.uintptr_t(entityPtr))
-	if cName == nil {
-		return ""
-	}
-	return C.GoString(cName)
+	return internedString(uint32(C.call_entity_classname_id(callbacks, C.uintptr_t(entityPtr))))
 }
 
 // IsEntityValid returns true if the entity pointer is valid.
@@ -842,8 +1046,9 @@ func ResolveGamedata(name string) uintptr {
 		return 0
 	}
 
-	cName := C.CString(name)
-	defer C.free(unsafe.Pointer(cName))
+	arg := getArena()
+	defer arg.release()
+	cName := arg.str(name)
 
 	return uintptr(C.call_resolve_gamedata(callbacks, cName))
 }
@@ -855,8 +1060,9 @@ func GetGamedataOffset(name string) int32 {
 		return -1
 	}
 
-	cName := C.CString(name)
-	defer C.free(unsafe.Pointer(cName))
+	arg := getArena()
+	defer arg.release()
+	cName := arg.str(name)
 
 	return int32(C.call_get_gamedata_offset(callbacks, cName))
 }
@@ -870,8 +1076,9 @@ func ConVarGetInt(name string) int32 {
 	if callbacks == nil {
 		return 0
 	}
-	cName := C.CString(name)
-	defer C.free(unsafe.Pointer(cName))
+	arg := getArena()
+	defer arg.release()
+	cName := arg.str(name)
 	return int32(C.call_convar_get_int(callbacks, cName))
 }
 
@@ -880,8 +1087,9 @@ func ConVarSetInt(name string, value int32) {
 	if callbacks == nil {
 		return
 	}
-	cName := C.CString(name)
-	defer C.free(unsafe.Pointer(cName))
+	arg := getArena()
+	defer arg.release()
+	cName := arg.str(name)
 	C.call_convar_set_int(callbacks, cName, C.int32_t(value))
 }
 
@@ -890,8 +1098,9 @@ func ConVarGetFloat(name string) float32 {
 	if callbacks == nil {
 		return 0
 	}
-	cName := C.CString(name)
-	defer C.free(unsafe.Pointer(cName))
+	arg := getArena()
+	defer arg.release()
+	cName := arg.str(name)
 	return float32(C.call_convar_get_float(callbacks, cName))
 }
 
@@ -900,8 +1109,9 @@ func ConVarSetFloat(name string, value float32) {
 	if callbacks == nil {
 		return
 	}
-	cName := C.CString(name)
-	defer C.free(unsafe.Pointer(cName))
+	arg := getArena()
+	defer arg.release()
+	cName := arg.str(name)
 	C.call_convar_set_float(callbacks, cName, C.float(value))
 }
 
@@ -910,8 +1120,9 @@ func ConVarGetString(name string) string {
 	if callbacks == nil {
 		return ""
 	}
-	cName := C.CString(name)
-	defer C.free(unsafe.Pointer(cName))
+	arg := getArena()
+	defer arg.release()
+	cName := arg.str(name)
 
 	var buf [1024]C.char
 	length := C.call_convar_get_string(callbacks, cName, &buf[0], 1024)
@@ -926,10 +1137,10 @@ func ConVarSetString(name string, value string) {
 	if callbacks == nil {
 		return
 	}
-	cName := C.CString(name)
-	cValue := C.CString(value)
-	defer C.free(unsafe.Pointer(cName))
-	defer C.free(unsafe.Pointer(cValue))
+	arg := getArena()
+	defer arg.release()
+	cName := arg.str(name)
+	cValue := arg.str(value)
 	C.call_convar_set_string(callbacks, cName, cValue)
 }
 
@@ -1012,8 +1223,9 @@ func EntitySetModel(entityPtr uintptr, model string) {
 	if callbacks == nil {
 		return
 	}
-	cModel := C.CString(model)
-	defer C.free(unsafe.Pointer(cModel))
+	arg := getArena()
+	defer arg.release()
+	cModel := arg.str(model)
 	C.call_entity_set_model(callbacks, C.uintptr_t(entityPtr), cModel)
 }
 
@@ -1035,8 +1247,9 @@ func ClientPrint(slot int, dest int, message string) {
 	if callbacks == nil {
 		return
 	}
-	cMsg := C.CString(message)
-	defer C.free(unsafe.Pointer(cMsg))
+	arg := getArena()
+	defer arg.release()
+	cMsg := arg.str(message)
 	C.call_client_print(callbacks, C.int32_t(slot), C.int32_t(dest), cMsg)
 }
 
@@ -1045,8 +1258,9 @@ func ClientPrintAll(dest int, message string) {
 	if callbacks == nil {
 		return
 	}
-	cMsg := C.CString(message)
-	defer C.free(unsafe.Pointer(cMsg))
+	arg := getArena()
+	defer arg.release()
+	cMsg := arg.str(message)
 	C.call_client_print_all(callbacks, C.int32_t(dest), cMsg)
 }
 
@@ -1059,8 +1273,9 @@ func EventGetInt(eventPtr uintptr, key string) int32 {
 	if callbacks == nil {
 		return 0
 	}
-	cKey := C.CString(key)
-	defer C.free(unsafe.Pointer(cKey))
+	arg := getArena()
+	defer arg.release()
+	cKey := arg.str(key)
 	return int32(C.call_event_get_int(callbacks, C.uintptr_t(eventPtr), cKey))
 }
 
@@ -1069,8 +1284,9 @@ func EventGetFloat(eventPtr uintptr, key string) float32 {
 	if callbacks == nil {
 		return 0
 	}
-	cKey := C.CString(key)
-	defer C.free(unsafe.Pointer(cKey))
+	arg := getArena()
+	defer arg.release()
+	cKey := arg.str(key)
 	return float32(C.call_event_get_float(callbacks, C.uintptr_t(eventPtr), cKey))
 }
 
@@ -1079,8 +1295,9 @@ func EventGetBool(eventPtr uintptr, key string) bool {
 	if callbacks == nil {
 		return false
 	}
-	cKey := C.CString(key)
-	defer C.free(unsafe.Pointer(cKey))
+	arg := getArena()
+	defer arg.release()
+	cKey := arg.str(key)
 	return bool(C.call_event_get_bool(callbacks, C.uintptr_t(eventPtr), cKey))
 }
 
@@ -1089,8 +1306,9 @@ func EventGetString(eventPtr uintptr, key string) string {
 	if callbacks == nil {
 		return ""
 	}
-	cKey := C.CString(key)
-	defer C.free(unsafe.Pointer(cKey))
+	arg := getArena()
+	defer arg.release()
+	cKey := arg.str(key)
 
 	var buf [1024]C.char
 	length := C.call_event_get_string(callbacks, C.uintptr_t(eventPtr), cKey, &buf[0], 1024)
@@ -1105,8 +1323,9 @@ func EventGetUint64(eventPtr uintptr, key string) uint64 {
 	if callbacks == nil {
 		return 0
 	}
-	cKey := C.CString(key)
-	defer C.free(unsafe.Pointer(cKey))
+	arg := getArena()
+	defer arg.release()
+	cKey := arg.str(key)
 	return uint64(C.call_event_get_uint64(callbacks, C.uintptr_t(eventPtr), cKey))
 }
 
@@ -1115,8 +1334,9 @@ func EventSetInt(eventPtr uintptr, key string, value int32) {
 	if callbacks == nil {
 		return
 	}
-	cKey := C.CString(key)
-	defer C.free(unsafe.Pointer(cKey))
+	arg := getArena()
+	defer arg.release()
+	cKey := arg.str(key)
 	C.call_event_set_int(callbacks, C.uintptr_t(eventPtr), cKey, C.int32_t(value))
 }
 
@@ -1125,8 +1345,9 @@ func EventSetFloat(eventPtr uintptr, key string, value float32) {
 	if callbacks == nil {
 		return
 	}
-	cKey := C.CString(key)
-	defer C.free(unsafe.Pointer(cKey))
+	arg := getArena()
+	defer arg.release()
+	cKey := arg.str(key)
 	C.call_event_set_float(callbacks, C.uintptr_t(eventPtr), cKey, C.float(value))
 }
 
@@ -1135,8 +1356,9 @@ func EventSetBool(eventPtr uintptr, key string, value bool) {
 	if callbacks == nil {
 		return
 	}
-	cKey := C.CString(key)
-	defer C.free(unsafe.Pointer(cKey))
+	arg := getArena()
+	defer arg.release()
+	cKey := arg.str(key)
 	C.call_event_set_bool(callbacks, C.uintptr_t(eventPtr), cKey, C.bool(value))
 }
 
@@ -1145,10 +1367,10 @@ func EventSetString(eventPtr uintptr, key string, value string) {
 	if callbacks == nil {
 		return
 	}
-	cKey := C.CString(key)
-	cVal := C.CString(value)
-	defer C.free(unsafe.Pointer(cKey))
-	defer C.free(unsafe.Pointer(cVal))
+	arg := getArena()
+	defer arg.release()
+	cKey := arg.str(key)
+	cVal := arg.str(value)
 	C.call_event_set_string(callbacks, C.uintptr_t(eventPtr), cKey, cVal)
 }
 
@@ -1161,8 +1383,9 @@ func GiveNamedItem(slot int, itemName string) {
 	if callbacks == nil {
 		return
 	}
-	cName := C.CString(itemName)
-	defer C.free(unsafe.Pointer(cName))
+	arg := getArena()
+	defer arg.release()
+	cName := arg.str(itemName)
 	C.call_give_named_item(callbacks, C.int32_t(slot), cName)
 }
 
@@ -1173,3 +1396,993 @@ func PlayerDropWeapons(slot int) {
 	}
 	C.call_player_drop_weapons(callbacks, C.int32_t(slot))
 }
+
+// ============================================================
+// V6: Entity Queries
+// ============================================================
+
+// InvalidHandle is the raw entity handle value that never refers to an entity
+const InvalidHandle = uint32(C.GS_INVALID_HANDLE)
+
+// FindEntitiesByClassName returns every live entity whose classname matches,
+// using a single native walk of the entity list. With prefix set (or a trailing
+// '*' in className) the name is matched as a prefix, e.g. "weapon_*".
+func FindEntitiesByClassName(className string, prefix bool) []EntityRef {
+	if callbacks == nil {
+		return nil
+	}
+
+	arg := getArena()
+	defer arg.release()
+	cName := arg.str(className)
+
+	buf := make([]C.gs_entity_ref_t, 256)
+	count := int(C.call_find_entities_by_classname(callbacks, cName, C.bool(prefix), &buf[0], C.int32_t(len(buf))))
+	if count > len(buf) {
+		// More matches than the first buffer could hold; retry with an exact fit
+		buf = make([]C.gs_entity_ref_t, count)
+		count = int(C.call_find_entities_by_classname(callbacks, cName, C.bool(prefix), &buf[0], C.int32_t(len(buf))))
+		if count > len(buf) {
+			count = len(buf)
+		}
+	}
+	if count <= 0 {
+		return nil
+	}
+	return entityRefsFromC(buf[:count])
+}
+
+// entityRefsFromC converts native entity refs. Classnames are interned
+// natively, so each distinct pointer is converted once.
+func entityRefsFromC(buf []C.gs_entity_ref_t) []EntityRef {
+	names := make(map[uintptr]string, 4)
+	refs := make([]EntityRef, len(buf))
+	for i := range buf {
+		namePtr := uintptr(C.entity_ref_classname(&buf[i]))
+		name, ok := names[namePtr]
+		if !ok {
+			name = C.GoString(buf[i].classname)
+			names[namePtr] = name
+		}
+		refs[i] = EntityRef{
+			Index:     uint32(buf[i].index),
+			Handle:    uint32(buf[i].handle),
+			Ptr:       uintptr(C.entity_ref_ptr(&buf[i])),
+			ClassName: name,
+		}
+	}
+	return refs
+}
+
+// GetEntityHandle returns the raw CEntityHandle of an entity.
+// Returns InvalidHandle if the entity is not valid.
+func GetEntityHandle(entityPtr uintptr) uint32 {
+	if callbacks == nil {
+		return InvalidHandle
+	}
+	return uint32(C.call_get_entity_handle(callbacks, C.uintptr_t(entityPtr)))
+}
+
+// ============================================================
+// V6: Entity Spawning
+// ============================================================
+
+// SpawnSpec describes one entity to create in a SpawnEntities batch
+type SpawnSpec struct {
+	ClassName string
+	Model     string
+	Origin    [3]float32
+	Angles    [3]float32
+	KeyValues map[string]string
+}
+
+// SpawnEntities creates, configures and spawns a batch of entities in one call.
+// The result has one entry per spec; failed spawns have Handle == InvalidHandle.
+// Must be called from the game thread (tick, event, command or timer handlers).
+func SpawnEntities(specs []SpawnSpec) []EntityRef {
+	if callbacks == nil || len(specs) == 0 {
+		return nil
+	}
+
+	// All strings and key-value arrays live in C memory for the duration of the call
+	arg := getArena()
+	defer arg.release()
+	cstr := func(str string) *C.char {
+		if str == "" {
+			return nil
+		}
+		return arg.str(str)
+	}
+
+	totalKV := 0
+	for i := range specs {
+		totalKV += len(specs[i].KeyValues)
+	}
+	var kvs []C.gs_keyvalue_t
+	if totalKV > 0 {
+		kvMem := C.malloc(C.size_t(totalKV) * C.size_t(unsafe.Sizeof(C.gs_keyvalue_t{})))
+		defer C.free(kvMem)
+		kvs = unsafe.Slice((*C.gs_keyvalue_t)(kvMem), totalKV)
+	}
+
+	cSpecs := make([]C.gs_spawn_spec_t, len(specs))
+	kvPos := 0
+	for i := range specs {
+		spec := &specs[i]
+		cSpecs[i].classname = cstr(spec.ClassName)
+		cSpecs[i].model = cstr(spec.Model)
+		cSpecs[i].origin = C.gs_vector3_t{x: C.float(spec.Origin[0]), y: C.float(spec.Origin[1]), z: C.float(spec.Origin[2])}
+		cSpecs[i].angles = C.gs_vector3_t{x: C.float(spec.Angles[0]), y: C.float(spec.Angles[1]), z: C.float(spec.Angles[2])}
+		if len(spec.KeyValues) > 0 {
+			cSpecs[i].keyvalues = &kvs[kvPos]
+			cSpecs[i].keyvalue_count = C.int32_t(len(spec.KeyValues))
+			for k, v := range spec.KeyValues {
+				kvs[kvPos].key = cstr(k)
+				kvs[kvPos].value = arg.str(v)
+				kvPos++
+			}
+		}
+	}
+
+	out := make([]C.gs_entity_ref_t, len(specs))
+	C.call_spawn_entities(callbacks, &cSpecs[0], C.int32_t(len(cSpecs)), &out[0])
+
+	refs := make([]EntityRef, len(out))
+	for i := range out {
+		refs[i] = EntityRef{
+			Index:  uint32(out[i].index),
+			Handle: uint32(out[i].handle),
+			Ptr:    uintptr(C.entity_ref_ptr(&out[i])),
+		}
+		if out[i].classname != nil {
+			refs[i].ClassName = C.GoString(out[i].classname)
+		}
+	}
+	return refs
+}
+
+// RemoveEntities removes a batch of entities by handle in one call.
+// Stale handles are skipped. Returns the number of entities removed.
+func RemoveEntities(handles []uint32) int {
+	if callbacks == nil || len(handles) == 0 {
+		return 0
+	}
+	return int(C.call_remove_entities(callbacks, (*C.uint32_t)(unsafe.Pointer(&handles[0])), C.int32_t(len(handles))))
+}
+
+// InputRequest describes one entity input to fire with FireInputs
+type InputRequest struct {
+	Target    uint32  // target entity handle
+	Input     string  // input name, e.g. "Open"
+	Value     string  // optional parameter, empty for none
+	Activator uint32  // activator handle, InvalidHandle for none
+	Caller    uint32  // caller handle, InvalidHandle for none
+	Delay     float32 // seconds; <= 0 fires immediately
+}
+
+// FireInputs dispatches a batch of entity inputs in a single native call.
+// Input names are interned natively, so repeating the same input is cheap.
+// Returns the number of requests dispatched.
+func FireInputs(reqs []InputRequest) int {
+	if callbacks == nil || len(reqs) == 0 {
+		return 0
+	}
+
+	// Deduplicate C strings within the batch (round-start batches repeat the same inputs)
+	arg := getArena()
+	defer arg.release()
+	cStrings := make(map[string]*C.char)
+	cstr := func(str string) *C.char {
+		if str == "" {
+			return nil
+		}
+		if c, ok := cStrings[str]; ok {
+			return c
+		}
+		c := arg.str(str)
+		cStrings[str] = c
+		return c
+	}
+
+	cReqs := make([]C.gs_input_req_t, len(reqs))
+	for i := range reqs {
+		req := &reqs[i]
+		cReqs[i].target = C.uint32_t(req.Target)
+		cReqs[i].input = cstr(req.Input)
+		cReqs[i].value = cstr(req.Value)
+		cReqs[i].activator = C.uint32_t(req.Activator)
+		cReqs[i].caller = C.uint32_t(req.Caller)
+		cReqs[i].delay = C.float(req.Delay)
+	}
+
+	return int(C.call_fire_inputs(callbacks, &cReqs[0], C.int32_t(len(cReqs))))
+}
+
+// SubscribeEntityOutput enables or disables native recording of an entity output.
+// handle may be InvalidHandle to match every entity firing the output.
+func SubscribeEntityOutput(handle uint32, output string, enable bool) {
+	if callbacks == nil {
+		return
+	}
+	arg := getArena()
+	defer arg.release()
+	cOutput := arg.str(output)
+	C.call_subscribe_entity_output(callbacks, C.uint32_t(handle), cOutput, C.bool(enable))
+}
+
+// SubscribeTriggerTouch enables or disables native recording of StartTouch/EndTouch on a trigger.
+// handle may be InvalidHandle to match every trigger.
+func SubscribeTriggerTouch(handle uint32, enable bool) {
+	if callbacks == nil {
+		return
+	}
+	C.call_subscribe_trigger_touch(callbacks, C.uint32_t(handle), C.bool(enable))
+}
+
+// TransmitSetHidden hides (or unhides) entity indices from a player (slot -1 = every player).
+// The filter is applied natively in CheckTransmit; nothing calls back into Go per tick.
+func TransmitSetHidden(slot int, indices []uint32, hidden bool) {
+	if callbacks == nil || len(indices) == 0 {
+		return
+	}
+	C.call_transmit_set_hidden(callbacks, C.int32_t(slot), (*C.uint32_t)(unsafe.Pointer(&indices[0])), C.int32_t(len(indices)), C.bool(hidden))
+}
+
+// TransmitClear unhides every entity for a player (slot -1 = every player).
+func TransmitClear(slot int) {
+	if callbacks == nil {
+		return
+	}
+	C.call_transmit_clear(callbacks, C.int32_t(slot))
+}
+
+// VisibilityConfig mirrors gs_visibility_config_t
+type VisibilityConfig struct {
+	IntervalTicks       int
+	BudgetMicros        int
+	MaxDistance         float32
+	FOVDegrees          float32
+	TransmitHideEnemies bool
+}
+
+// ConfigureVisibility replaces the native line-of-sight sweep configuration.
+func ConfigureVisibility(cfg VisibilityConfig) {
+	if callbacks == nil {
+		return
+	}
+	cCfg := C.gs_visibility_config_t{
+		interval_ticks:        C.int32_t(cfg.IntervalTicks),
+		budget_us:             C.int32_t(cfg.BudgetMicros),
+		max_distance:          C.float(cfg.MaxDistance),
+		fov_degrees:           C.float(cfg.FOVDegrees),
+		transmit_hide_enemies: C.bool(cfg.TransmitHideEnemies),
+	}
+	C.call_visibility_configure(callbacks, &cCfg)
+}
+
+// GetVisibilityMatrix copies the last completed 64x64 visibility matrix in one call.
+// Bit j of rows[i] is set if slot i can see slot j. Returns the sweep generation (0 = none yet).
+func GetVisibilityMatrix(rows *[64]uint64) int {
+	if callbacks == nil || rows == nil {
+		return 0
+	}
+	return int(C.call_visibility_get_matrix(callbacks, (*C.uint64_t)(unsafe.Pointer(&rows[0]))))
+}
+
+// Trace masks matching C++ GS_TRACE_CONTENTS_*
+const (
+	TraceContentsSolid         = uint64(C.GS_TRACE_CONTENTS_SOLID)
+	TraceContentsHitbox        = uint64(C.GS_TRACE_CONTENTS_HITBOX)
+	TraceContentsTrigger       = uint64(C.GS_TRACE_CONTENTS_TRIGGER)
+	TraceContentsSky           = uint64(C.GS_TRACE_CONTENTS_SKY)
+	TraceContentsPlayerClip    = uint64(C.GS_TRACE_CONTENTS_PLAYER_CLIP)
+	TraceContentsBlockLOS      = uint64(C.GS_TRACE_CONTENTS_BLOCK_LOS)
+	TraceContentsWindow        = uint64(C.GS_TRACE_CONTENTS_WINDOW)
+	TraceContentsWorldGeometry = uint64(C.GS_TRACE_CONTENTS_WORLD_GEOMETRY)
+	TraceContentsWater         = uint64(C.GS_TRACE_CONTENTS_WATER)
+	TraceContentsPlayer        = uint64(C.GS_TRACE_CONTENTS_PLAYER)
+	TraceContentsNPC           = uint64(C.GS_TRACE_CONTENTS_NPC)
+	TraceContentsDebris        = uint64(C.GS_TRACE_CONTENTS_DEBRIS)
+	TraceContentsPhysicsProp   = uint64(C.GS_TRACE_CONTENTS_PHYSICS_PROP)
+)
+
+// TraceAnyHit stops a trace batch at the first ray that hits
+const TraceAnyHit = uint32(C.GS_TRACE_ANY_HIT)
+
+// Ray mirrors gs_ray_t
+type Ray struct {
+	Start  [3]float32
+	End    [3]float32
+	Mins   [3]float32 // zero box = line trace
+	Maxs   [3]float32
+	Ignore uint32 // entity handle to pass through, InvalidHandle for none
+}
+
+// TraceResult mirrors gs_trace_result_t
+type TraceResult struct {
+	Hit        bool
+	StartSolid bool
+	Fraction   float32
+	End        [3]float32
+	Normal     [3]float32
+	Entity     EntityRef // Ptr is 0 for world hits or no hit
+}
+
+func toCVector(v [3]float32) C.gs_vector3_t {
+	return C.gs_vector3_t{x: C.float(v[0]), y: C.float(v[1]), z: C.float(v[2])}
+}
+
+// TraceAvailable reports whether native engine traces work
+// (TracePlayerBBox resolved from gamedata).
+func TraceAvailable() bool {
+	if callbacks == nil {
+		return false
+	}
+	return bool(C.call_trace_available(callbacks))
+}
+
+// TraceBatch traces every ray in a single native call.
+// Returns one result per ray (rays after the first hit are empty with TraceAnyHit)
+// and the number of rays that hit.
+func TraceBatch(rays []Ray, mask uint64, flags uint32) ([]TraceResult, int) {
+	if callbacks == nil || len(rays) == 0 {
+		return nil, 0
+	}
+
+	cRays := make([]C.gs_ray_t, len(rays))
+	for i := range rays {
+		cRays[i].start = toCVector(rays[i].Start)
+		cRays[i].end = toCVector(rays[i].End)
+		cRays[i].mins = toCVector(rays[i].Mins)
+		cRays[i].maxs = toCVector(rays[i].Maxs)
+		cRays[i].ignore = C.uint32_t(rays[i].Ignore)
+	}
+
+	out := make([]C.gs_trace_result_t, len(rays))
+	hits := int(C.call_trace_batch(callbacks, &cRays[0], C.int32_t(len(cRays)), C.uint64_t(mask), C.uint32_t(flags), &out[0]))
+
+	results := make([]TraceResult, len(out))
+	for i := range out {
+		r := &out[i]
+		results[i] = TraceResult{
+			Hit:        bool(r.hit),
+			StartSolid: bool(r.start_solid),
+			Fraction:   float32(r.fraction),
+			End:        [3]float32{float32(r.end.x), float32(r.end.y), float32(r.end.z)},
+			Normal:     [3]float32{float32(r.normal.x), float32(r.normal.y), float32(r.normal.z)},
+			Entity: EntityRef{
+				Index:  uint32(r.entity.index),
+				Handle: uint32(r.entity.handle),
+				Ptr:    uintptr(C.entity_ref_ptr(&r.entity)),
+			},
+		}
+		if r.entity.classname != nil {
+			results[i].Entity.ClassName = C.GoString(r.entity.classname)
+		}
+	}
+	return results, hits
+}
+
+// ============================================================
+// V6: Batched Player Operations
+// ============================================================
+
+// Player operation kinds
+const (
+	PlayerOpRespawn   = int32(C.GS_PLAYER_OP_RESPAWN)
+	PlayerOpTeleport  = int32(C.GS_PLAYER_OP_TELEPORT)
+	PlayerOpSetHealth = int32(C.GS_PLAYER_OP_SET_HEALTH)
+	PlayerOpSetArmor  = int32(C.GS_PLAYER_OP_SET_ARMOR)
+	PlayerOpStrip     = int32(C.GS_PLAYER_OP_STRIP)
+	PlayerOpGiveItem  = int32(C.GS_PLAYER_OP_GIVE_ITEM)
+	PlayerOpSetTeam   = int32(C.GS_PLAYER_OP_SET_TEAM)
+)
+
+// Teleport flags selecting which vectors are applied
+const (
+	PlayerOpOrigin   = uint32(C.GS_PLAYER_OP_ORIGIN)
+	PlayerOpAngles   = uint32(C.GS_PLAYER_OP_ANGLES)
+	PlayerOpVelocity = uint32(C.GS_PLAYER_OP_VELOCITY)
+)
+
+// PlayerOp is one entry of a player command buffer
+type PlayerOp struct {
+	Kind     int32
+	Slot     int32
+	Value    int32
+	Flags    uint32
+	Origin   [3]float32
+	Angles   [3]float32
+	Velocity [3]float32
+	Item     string
+}
+
+// SubmitPlayerOps executes the ops in order in a single native call.
+// Returns the number of ops that were applied.
+func SubmitPlayerOps(ops []PlayerOp) int {
+	if callbacks == nil || len(ops) == 0 {
+		return 0
+	}
+
+	// Item names repeat across players; convert each distinct name once
+	arg := getArena()
+	defer arg.release()
+	items := make(map[string]*C.char)
+
+	cOps := make([]C.gs_player_op_t, len(ops))
+	for i := range ops {
+		op := &ops[i]
+		cOps[i].kind = C.int32_t(op.Kind)
+		cOps[i].slot = C.int32_t(op.Slot)
+		cOps[i].value = C.int32_t(op.Value)
+		cOps[i].flags = C.uint32_t(op.Flags)
+		cOps[i].origin = toCVector(op.Origin)
+		cOps[i].angles = toCVector(op.Angles)
+		cOps[i].velocity = toCVector(op.Velocity)
+		if op.Item != "" {
+			c, ok := items[op.Item]
+			if !ok {
+				c = arg.str(op.Item)
+				items[op.Item] = c
+			}
+			cOps[i].item = c
+		}
+	}
+
+	return int(C.call_player_ops_submit(callbacks, &cOps[0], C.int32_t(len(cOps))))
+}
+
+// ============================================================
+// V6: Weapon Registry
+// ============================================================
+
+// ItemInvalid is the item ID of an unknown item
+const ItemInvalid = int32(C.GS_ITEM_INVALID)
+
+// weaponListMax bounds a single registry copy
+const weaponListMax = 256
+
+// WeaponInfo mirrors gs_weapon_info_t
+type WeaponInfo struct {
+	ItemID      int32
+	DefIndex    int32
+	ClassName   string
+	VData       uintptr
+	Price       int32
+	KillAward   int32
+	MaxClip1    int32
+	ReserveAmmo int32
+	GearSlot    int32
+	WeaponType  int32
+}
+
+// WeaponList copies the native weapon registry in one call
+func WeaponList() []WeaponInfo {
+	if callbacks == nil {
+		return nil
+	}
+
+	out := make([]C.gs_weapon_info_t, weaponListMax)
+	n := int(C.call_weapon_list(callbacks, &out[0], C.int32_t(len(out))))
+
+	infos := make([]WeaponInfo, n)
+	for i := 0; i < n; i++ {
+		w := &out[i]
+		infos[i] = WeaponInfo{
+			ItemID:      int32(w.item_id),
+			DefIndex:    int32(w.def_index),
+			VData:       uintptr(C.weapon_info_vdata(w)),
+			Price:       int32(w.price),
+			KillAward:   int32(w.kill_award),
+			MaxClip1:    int32(w.max_clip1),
+			ReserveAmmo: int32(w.reserve_ammo),
+			GearSlot:    int32(w.gear_slot),
+			WeaponType:  int32(w.weapon_type),
+		}
+		if w.classname != nil {
+			infos[i].ClassName = C.GoString(w.classname)
+		}
+	}
+	return infos
+}
+
+// GiveItems gives items by registry ID. Returns the number given.
+func GiveItems(slot int, ids []int32) int {
+	if callbacks == nil || len(ids) == 0 {
+		return 0
+	}
+	cIDs := make([]C.int32_t, len(ids))
+	for i, id := range ids {
+		cIDs[i] = C.int32_t(id)
+	}
+	return int(C.call_give_items(callbacks, C.int32_t(slot), &cIDs[0], C.int32_t(len(cIDs))))
+}
+
+// ============================================================
+// V6: Item Restrictions
+// ============================================================
+
+// Item rule kinds
+const (
+	ItemRuleTeamDeny = int32(C.GS_ITEM_RULE_TEAM_DENY)
+	ItemRuleSlotDeny = int32(C.GS_ITEM_RULE_SLOT_DENY)
+	ItemRuleEscalate = int32(C.GS_ITEM_RULE_ESCALATE)
+)
+
+// Acquire methods reported to escalation handlers
+const (
+	AcquirePickup = int32(C.GS_ACQUIRE_PICKUP)
+	AcquireBuy    = int32(C.GS_ACQUIRE_BUY)
+	AcquireUse    = int32(C.GS_ACQUIRE_USE)
+)
+
+// ItemRulesSet sets or clears a rule for a list of item IDs
+func ItemRulesSet(rule, target int32, ids []int32, enable bool) {
+	if callbacks == nil || len(ids) == 0 {
+		return
+	}
+	cIDs := make([]C.int32_t, len(ids))
+	for i, id := range ids {
+		cIDs[i] = C.int32_t(id)
+	}
+	C.call_item_rules_set(callbacks, C.int32_t(rule), C.int32_t(target), &cIDs[0], C.int32_t(len(cIDs)), C.bool(enable))
+}
+
+// ItemSetLimit sets a per-team item limit (-1 = unlimited)
+func ItemSetLimit(team, itemID, limit int32) {
+	if callbacks == nil {
+		return
+	}
+	C.call_item_set_limit(callbacks, C.int32_t(team), C.int32_t(itemID), C.int32_t(limit))
+}
+
+// ItemSetCount updates a team's current holder count for an item
+func ItemSetCount(team, itemID, count int32) {
+	if callbacks == nil {
+		return
+	}
+	C.call_item_set_count(callbacks, C.int32_t(team), C.int32_t(itemID), C.int32_t(count))
+}
+
+// ItemRulesClear drops all item rules, limits and counts
+func ItemRulesClear() {
+	if callbacks == nil {
+		return
+	}
+	C.call_item_rules_clear(callbacks)
+}
+
+// ============================================================
+// V6: Generic Function Hooks
+// ============================================================
+
+// Hook argument/return types
+const (
+	HookTypeVoid    = int32(C.GS_HOOK_TYPE_VOID)
+	HookTypeInt32   = int32(C.GS_HOOK_TYPE_INT32)
+	HookTypeInt64   = int32(C.GS_HOOK_TYPE_INT64)
+	HookTypePointer = int32(C.GS_HOOK_TYPE_POINTER)
+	HookTypeFloat   = int32(C.GS_HOOK_TYPE_FLOAT)
+	HookTypeDouble  = int32(C.GS_HOOK_TYPE_DOUBLE)
+	HookTypeBool    = int32(C.GS_HOOK_TYPE_BOOL)
+	HookTypeVector  = int32(C.GS_HOOK_TYPE_VECTOR)
+)
+
+// Hook handler results
+const (
+	HookContinue  = int(C.GS_HOOK_CONTINUE)
+	HookChanged   = int(C.GS_HOOK_CHANGED)
+	HookSupercede = int(C.GS_HOOK_SUPERCEDE)
+)
+
+// HookMaxArgs is the maximum number of declared hook arguments
+const HookMaxArgs = int(C.GS_HOOK_MAX_ARGS)
+
+// HookDefine defines a hook on a gamedata signature. Returns the hook ID or -1.
+func HookDefine(name string, retType int32, argTypes []int32) int32 {
+	if callbacks == nil {
+		return -1
+	}
+	arg := getArena()
+	defer arg.release()
+	cName := arg.str(name)
+
+	var cArgs *C.int32_t
+	if len(argTypes) > 0 {
+		args := make([]C.int32_t, len(argTypes))
+		for i, t := range argTypes {
+			args[i] = C.int32_t(t)
+		}
+		cArgs = &args[0]
+	}
+	return int32(C.call_hook_define(callbacks, cName, C.int32_t(retType), cArgs, C.int32_t(len(argTypes))))
+}
+
+// HookSubscribe adds or removes one Go subscription to a hook chain
+func HookSubscribe(hookID int32, post, enable bool) {
+	if callbacks == nil {
+		return
+	}
+	C.call_hook_subscribe(callbacks, C.int32_t(hookID), C.bool(post), C.bool(enable))
+}
+
+// ReadVector reads a Vector from native memory (e.g. a VECTOR hook argument)
+func ReadVector(ptr uintptr) [3]float32 {
+	if ptr == 0 {
+		return [3]float32{}
+	}
+	v := C.read_vector(C.uintptr_t(ptr))
+	return [3]float32{float32(v.x), float32(v.y), float32(v.z)}
+}
+
+// WriteVector writes a Vector to native memory
+func WriteVector(ptr uintptr, v [3]float32) {
+	if ptr == 0 {
+		return
+	}
+	C.write_vector(C.uintptr_t(ptr), toCVector(v))
+}
+
+// ============================================================
+// V6: Native Calls
+// ============================================================
+
+// CallDefine describes a native function (gamedata name, or a vtable index >= 0).
+// Returns the call ID or -1.
+func CallDefine(name string, vtableIndex int32, retType int32, argTypes []int32) int32 {
+	if callbacks == nil {
+		return -1
+	}
+	var cName *C.char
+	if name != "" {
+		arg := getArena()
+		defer arg.release()
+		cName = arg.str(name)
+	}
+
+	var cArgs *C.int32_t
+	if len(argTypes) > 0 {
+		args := make([]C.int32_t, len(argTypes))
+		for i, t := range argTypes {
+			args[i] = C.int32_t(t)
+		}
+		cArgs = &args[0]
+	}
+	return int32(C.call_call_define(callbacks, cName, C.int32_t(vtableIndex), C.int32_t(retType), cArgs, C.int32_t(len(argTypes))))
+}
+
+// CallInvoke invokes a defined native function. args holds one normalized slot
+// per declared argument; VECTOR slots index into vectors. Returns the
+// normalized return value and whether the call was made.
+func CallInvoke(callID int32, args []uint64, vectors [][3]float32) (uint64, bool) {
+	if callbacks == nil {
+		return 0, false
+	}
+	var cArgs *C.uint64_t
+	if len(args) > 0 {
+		cArgs = (*C.uint64_t)(unsafe.Pointer(&args[0]))
+	}
+	var cVecs *C.gs_vector3_t
+	if len(vectors) > 0 {
+		vecs := make([]C.gs_vector3_t, len(vectors))
+		for i, v := range vectors {
+			vecs[i] = toCVector(v)
+		}
+		cVecs = &vecs[0]
+	}
+	var ret C.uint64_t
+	ok := C.call_call_invoke(callbacks, C.int32_t(callID), cArgs, cVecs, &ret)
+	return uint64(ret), bool(ok)
+}
+
+// ============================================================
+// V6: Gamerules
+// ============================================================
+
+// GameRulesState is the per-frame round-state snapshot
+type GameRulesState struct {
+	GameRules      uintptr
+	Warmup         bool
+	FreezePeriod   bool
+	BombPlanted    bool
+	GamePhase      int32
+	RoundsPlayed   int32
+	RoundTime      int32
+	RoundStartTime float32
+	WarmupEnd      float32
+	WinReason      int32
+	ScoreT         int32
+	ScoreCT        int32
+}
+
+// GetGameRules returns the round-state snapshot from the last game frame
+func GetGameRules() GameRulesState {
+	if callbacks == nil {
+		return GameRulesState{}
+	}
+	s := C.call_get_gamerules(callbacks)
+	if s == nil {
+		return GameRulesState{}
+	}
+	return GameRulesState{
+		GameRules:      uintptr(C.gamerules_ptr(s)),
+		Warmup:         bool(s.warmup),
+		FreezePeriod:   bool(s.freeze_period),
+		BombPlanted:    bool(s.bomb_planted),
+		GamePhase:      int32(s.game_phase),
+		RoundsPlayed:   int32(s.rounds_played),
+		RoundTime:      int32(s.round_time),
+		RoundStartTime: float32(s.round_start_time),
+		WarmupEnd:      float32(s.warmup_end),
+		WinReason:      int32(s.win_reason),
+		ScoreT:         int32(s.score_t),
+		ScoreCT:        int32(s.score_ct),
+	}
+}
+
+// TerminateRound ends the current round
+func TerminateRound(delay float32, reason int32) bool {
+	if callbacks == nil {
+		return false
+	}
+	return bool(C.call_terminate_round(callbacks, C.float(delay), C.int32_t(reason)))
+}
+
+// ============================================================
+// V6: Player Input
+// ============================================================
+
+// InputCapture adds or removes one subscription to native input capture
+func InputCapture(enable bool) {
+	if callbacks == nil {
+		return
+	}
+	C.call_input_capture(callbacks, C.bool(enable))
+}
+
+// ============================================================
+// V6: Player History
+// ============================================================
+
+// PlayerSample is a slot's interpolated state at a tick
+type PlayerSample struct {
+	Slot      int32
+	Valid     bool
+	Origin    [3]float32
+	EyeAngles [3]float32
+	Velocity  [3]float32
+	Flags     uint32
+}
+
+// HistoryQuery returns the interpolated state of many slots at tick in one call
+func HistoryQuery(slots []int32, tick float32) []PlayerSample {
+	if callbacks == nil || len(slots) == 0 {
+		return nil
+	}
+	cSlots := make([]C.int32_t, len(slots))
+	for i, s := range slots {
+		cSlots[i] = C.int32_t(s)
+	}
+	out := make([]C.gs_player_sample_t, len(slots))
+	C.call_history_query(callbacks, &cSlots[0], C.int32_t(len(slots)), C.float(tick), &out[0])
+
+	samples := make([]PlayerSample, len(out))
+	for i := range out {
+		o := &out[i]
+		samples[i] = PlayerSample{
+			Slot:      int32(o.slot),
+			Valid:     bool(o.valid),
+			Origin:    [3]float32{float32(o.origin.x), float32(o.origin.y), float32(o.origin.z)},
+			EyeAngles: [3]float32{float32(o.eye_angles.x), float32(o.eye_angles.y), float32(o.eye_angles.z)},
+			Velocity:  [3]float32{float32(o.velocity.x), float32(o.velocity.y), float32(o.velocity.z)},
+			Flags:     uint32(o.flags),
+		}
+	}
+	return samples
+}
+
+// HistoryLatestTick returns the newest recorded tick, or -1
+func HistoryLatestTick() int32 {
+	if callbacks == nil {
+		return -1
+	}
+	return int32(C.call_history_latest_tick(callbacks))
+}
+
+// ============================================================
+// V6: Property Watchers
+// ============================================================
+
+// WatchValueSize is the largest field, in bytes, a property watch can track
+const WatchValueSize = int(C.GS_WATCH_VALUE_SIZE)
+
+// WatchAdd watches size bytes of an entity's schema field for changes.
+// Returns the watch ID, or -1 on failure.
+func WatchAdd(entityHandle uint32, className, fieldName string, size int) int32 {
+	if callbacks == nil {
+		return -1
+	}
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
+	return int32(C.call_watch_add(callbacks, C.uint32_t(entityHandle), cClass, cField, C.int32_t(size)))
+}
+
+// WatchRemove stops a property watch
+func WatchRemove(watchID int32) {
+	if callbacks == nil {
+		return
+	}
+	C.call_watch_remove(callbacks, C.int32_t(watchID))
+}
+
+// ============================================================
+// V6: Field Paths
+// ============================================================
+
+// PathMaxValue is the largest value, in bytes, a field path read returns
+const PathMaxValue = int(C.GS_PATH_MAX_VALUE)
+
+// PathCompile compiles a "Class.field->Class.field" path. Returns -1 on error.
+func PathCompile(path string) int32 {
+	if callbacks == nil {
+		return -1
+	}
+	arg := getArena()
+	defer arg.release()
+	cPath := arg.str(path)
+	return int32(C.call_path_compile(callbacks, cPath))
+}
+
+// PathRead reads size bytes at the end of a compiled path for every handle in
+// one call. data holds len(handles)*size bytes; valid reports which were read.
+func PathRead(pathID int32, handles []uint32, size int) (data []byte, valid []bool) {
+	if callbacks == nil || len(handles) == 0 || size <= 0 || size > PathMaxValue {
+		return nil, nil
+	}
+	data = make([]byte, len(handles)*size)
+	valid = make([]bool, len(handles))
+	C.call_path_read(callbacks, C.int32_t(pathID),
+		(*C.uint32_t)(unsafe.Pointer(&handles[0])), C.int32_t(len(handles)), C.int32_t(size),
+		(*C.uint8_t)(unsafe.Pointer(&data[0])), (*C.bool)(unsafe.Pointer(&valid[0])))
+	return data, valid
+}
+
+// ============================================================
+// V6: Array Fields
+// ============================================================
+
+// Array field layouts
+const (
+	ArrayFixed     = int32(C.GS_ARRAY_FIXED)
+	ArrayUtlVector = int32(C.GS_ARRAY_UTLVECTOR)
+)
+
+// arrayReadCapacity is the first-try buffer size for CUtlVector reads
+const arrayReadCapacity = 64
+
+// EntityReadArray copies every element (elemSize bytes each) of an array field
+// in one call. length is the declared element count for ArrayFixed.
+// Returns false if the field is unknown.
+func EntityReadArray(entityPtr uintptr, className, fieldName string, kind, length int32, elemSize int) ([]byte, bool) {
+	if callbacks == nil || entityPtr == 0 || elemSize <= 0 {
+		return nil, false
+	}
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
+
+	capacity := arrayReadCapacity
+	if kind == ArrayFixed {
+		capacity = int(length)
+	}
+	for {
+		buf := make([]byte, (capacity+1)*elemSize) // +1 keeps &buf[0] valid for empty arrays
+		count := int(C.call_entity_read_array(callbacks, C.uintptr_t(entityPtr), cClass, cField,
+			C.int32_t(kind), C.int32_t(length), C.int32_t(elemSize), unsafe.Pointer(&buf[0]), C.int32_t(capacity)))
+		if count < 0 {
+			return nil, false
+		}
+		if count <= capacity {
+			return buf[:count*elemSize], true
+		}
+		// The vector outgrew the buffer; retry with an exact fit
+		capacity = count
+	}
+}
+
+// EntityReadHandles reads an array field of entity handles, resolving each
+// natively. Stale entries have Handle == InvalidHandle and Ptr == 0.
+// Returns false if the field is unknown.
+func EntityReadHandles(entityPtr uintptr, className, fieldName string, kind, length int32) ([]EntityRef, bool) {
+	if callbacks == nil || entityPtr == 0 {
+		return nil, false
+	}
+	arg := getArena()
+	defer arg.release()
+	cClass := arg.str(className)
+	cField := arg.str(fieldName)
+
+	capacity := arrayReadCapacity
+	if kind == ArrayFixed {
+		capacity = int(length)
+	}
+	for {
+		buf := make([]C.gs_entity_ref_t, capacity+1)
+		count := int(C.call_entity_read_handles(callbacks, C.uintptr_t(entityPtr), cClass, cField,
+			C.int32_t(kind), C.int32_t(length), &buf[0], C.int32_t(capacity)))
+		if count < 0 {
+			return nil, false
+		}
+		if count <= capacity {
+			return entityRefsFromC(buf[:count]), true
+		}
+		capacity = count
+	}
+}
+
+// ============================================================
+// V6: Interned Strings
+// ============================================================
+
+// Go copies of interned native strings, indexed by ID. An empty entry has not
+// been converted yet (ID 0 is always the empty string).
+var (
+	internedMu      sync.RWMutex
+	internedStrings []string
+)
+
+// nativeString converts a native string ID (replaced in tests)
+var nativeString = func(id uint32) (string, bool) {
+	if callbacks == nil {
+		return "", false
+	}
+	cStr := C.call_string_get(callbacks, C.uint32_t(id))
+	if cStr == nil {
+		return "", false
+	}
+	return C.GoString(cStr), true
+}
+
+// resetInternedStrings drops every cached copy. The native table restarts its
+// IDs when the plugin is reloaded, while the Go runtime lives on, so cached
+// entries would otherwise map new IDs to old strings.
+func resetInternedStrings() {
+	internedMu.Lock()
+	internedStrings = nil
+	internedMu.Unlock()
+}
+
+// internedString returns the string for a native string ID. Each ID is
+// converted with C.GoString once per plugin load; later calls are a slice lookup.
+func internedString(id uint32) string {
+	if id == 0 {
+		return ""
+	}
+
+	internedMu.RLock()
+	if int(id) < len(internedStrings) {
+		if s := internedStrings[id]; s != "" {
+			internedMu.RUnlock()
+			return s
+		}
+	}
+	internedMu.RUnlock()
+
+	s, ok := nativeString(id)
+	if !ok {
+		return ""
+	}
+
+	internedMu.Lock()
+	if int(id) >= len(internedStrings) {
+		grown := make([]string, int(id)+1+len(internedStrings)/2)
+		copy(grown, internedStrings)
+		internedStrings = grown
+	}
+	internedStrings[id] = s
+	internedMu.Unlock()
+	return s
+}
@@ -92,6 +92,7 @@ import (
 	"fmt"
 	"runtime/debug"
 	"sync"
+	"unsafe"
 
 	"github.com/corrreia/gostrike/internal/manager"
 	httpmod "github.com/corrreia/gostrike/internal/modules/http"
@@ -252,10 +253,21 @@ func GoStrike_Init() C.gs_error_t {
 			Log(cLevel, tag, message)
 		})
 
+		// String IDs from a previous load are meaningless to the new native table
+		resetInternedStrings()
+
 		// Set up callback functions for other packages
 		runtime.SetPanicLogger(func(context string, panicVal interface{}, stack string) {
 			logError("PANIC", fmt.Sprintf("Panic in %s: %v\n%s", context, panicVal, stack))
 		})
+		runtime.SetNativeSubscriptions(runtime.NativeSubscriptions{
+			EntityOutput: SubscribeEntityOutput,
+			TriggerTouch: SubscribeTriggerTouch,
+			Hook: func(hookID int, post, enable bool) {
+				HookSubscribe(int32(hookID), post, enable)
+			},
+			InputCapture: InputCapture,
+		})
 		shared.DebugLog("[GoStrike-Debug] Set callback functions")
 
 		// Wire up plugin list functions for gs command
@@ -379,7 +391,7 @@ func GoStrike_OnEvent(event *C.gs_event_t, isPost C.bool) C.gs_event_result_t {
 	}
 
 	return safeCallInt(func() C.gs_event_result_t {
-		eventName := C.GoStringN(event.name, C.int(event.name_len))
+		eventName := internedString(uint32(event.name_id))
 		result := runtime.DispatchEvent(eventName, uintptr(event.native_event), bool(isPost))
 		return C.gs_event_result_t(result)
 	}, C.GS_EVENT_CONTINUE)
@@ -430,32 +442,24 @@ func GoStrike_OnPlayerDisconnect(slot C.int32_t, reason *C.char) {
 // ============================================================
 
 //export GoStrike_OnEntityCreated
-func GoStrike_OnEntityCreated(index C.uint32_t, classname *C.char) {
+func GoStrike_OnEntityCreated(index C.uint32_t, classnameID C.uint32_t) {
 	if !initialized {
 		return
 	}
 
 	_ = safeCall(func() {
-		goClassname := ""
-		if classname != nil {
-			goClassname = C.GoString(classname)
-		}
-		runtime.DispatchEntityCreated(uint32(index), goClassname)
+		runtime.DispatchEntityCreated(uint32(index), internedString(uint32(classnameID)))
 	})
 }
 
 //export GoStrike_OnEntitySpawned
-func GoStrike_OnEntitySpawned(index C.uint32_t, classname *C.char) {
+func GoStrike_OnEntitySpawned(index C.uint32_t, classnameID C.uint32_t) {
 	if !initialized {
 		return
 	}
 
 	_ = safeCall(func() {
-		goClassname := ""
-		if classname != nil {
-			goClassname = C.GoString(classname)
-		}
-		runtime.DispatchEntitySpawned(uint32(index), goClassname)
+		runtime.DispatchEntitySpawned(uint32(index), internedString(uint32(classnameID)))
 	})
 }
 
@@ -486,6 +490,158 @@ func GoStrike_OnTakeDamage(victimIndex C.int32_t, attackerIndex C.int32_t, damag
 	}, C.GS_EVENT_CONTINUE)
 }
 
+// ============================================================
+// V6: Entity Output / Touch Export (called by C++ once per frame)
+// ============================================================
+
+// Output and class names in entity events are interned engine strings,
+// so each distinct pointer is converted to a Go string only once.
+var entityEventNames = make(map[uintptr]string)
+
+func entityEventName(str *C.char) string {
+	if str == nil {
+		return ""
+	}
+	key := uintptr(unsafe.Pointer(str))
+	name, ok := entityEventNames[key]
+	if !ok {
+		name = C.GoString(str)
+		entityEventNames[key] = name
+	}
+	return name
+}
+
+func entityEventRef(ref *C.gs_entity_ref_t) shared.EntityEventRef {
+	return shared.EntityEventRef{
+		Index:     uint32(ref.index),
+		Handle:    uint32(ref.handle),
+		Ptr:       uintptr(unsafe.Pointer(ref.entity)),
+		ClassName: entityEventName(ref.classname),
+	}
+}
+
+//export GoStrike_OnEntityEvents
+func GoStrike_OnEntityEvents(events *C.gs_entity_event_t, count C.int32_t) {
+	if !initialized || events == nil || count <= 0 {
+		return
+	}
+
+	_ = safeCall(func() {
+		cEvents := unsafe.Slice(events, int(count))
+		goEvents := make([]shared.EntityEvent, len(cEvents))
+		for i := range cEvents {
+			ev := &cEvents[i]
+			goEvents[i] = shared.EntityEvent{
+				Kind:   int(ev.kind),
+				Entity: entityEventRef(&ev.entity),
+				Other:  entityEventRef(&ev.other),
+				Output: entityEventName(ev.output),
+				Delay:  float32(ev.delay),
+			}
+		}
+		runtime.DispatchEntityEvents(goEvents)
+	})
+}
+
+// ============================================================
+// V6: Item Acquire Export (escalated weapon restriction checks)
+// ============================================================
+
+//export GoStrike_OnItemAcquire
+func GoStrike_OnItemAcquire(slot C.int32_t, itemID C.int32_t, method C.int32_t) C.gs_event_result_t {
+	if !initialized {
+		return C.GS_EVENT_CONTINUE
+	}
+
+	return safeCallInt(func() C.gs_event_result_t {
+		result := runtime.DispatchItemAcquire(int(slot), int(itemID), int(method))
+		return C.gs_event_result_t(result)
+	}, C.GS_EVENT_CONTINUE)
+}
+
+// ============================================================
+// V6: Generic Function Hook Export
+// ============================================================
+
+//export GoStrike_OnHook
+func GoStrike_OnHook(frame *C.gs_hook_frame_t) C.gs_hook_result_t {
+	if !initialized || frame == nil {
+		return C.GS_HOOK_CONTINUE
+	}
+
+	result := safeCallInt(func() C.gs_event_result_t {
+		goFrame := shared.HookFrame{
+			HookID:     int(frame.hook_id),
+			Post:       bool(frame.post),
+			Superceded: bool(frame.superceded),
+			Ret:        (*uint64)(unsafe.Pointer(&frame.ret)),
+		}
+		if frame.argc > 0 {
+			goFrame.Args = unsafe.Slice((*uint64)(unsafe.Pointer(&frame.args[0])), int(frame.argc))
+		}
+		return C.gs_event_result_t(runtime.DispatchHook(&goFrame))
+	}, C.GS_EVENT_CONTINUE)
+	return C.gs_hook_result_t(result)
+}
+
+// ============================================================
+// V6: Player Input Export
+// ============================================================
+
+// Reused every frame; handlers must not keep the frame
+var inputFrame shared.InputFrame
+
+//export GoStrike_OnPlayerInput
+func GoStrike_OnPlayerInput(frame *C.gs_input_frame_t) {
+	if !initialized || frame == nil {
+		return
+	}
+
+	_ = safeCall(func() {
+		inputFrame.Frame = int32(frame.frame)
+		inputFrame.Valid = uint64(frame.valid)
+		for slot := 0; slot < shared.MaxInputPlayers; slot++ {
+			if inputFrame.Valid&(1<<uint(slot)) == 0 {
+				continue
+			}
+			inputFrame.Buttons[slot] = uint64(frame.buttons[slot])
+			a := frame.view_angles[slot]
+			inputFrame.ViewAngles[slot] = [3]float32{float32(a.x), float32(a.y), float32(a.z)}
+			m := frame.move[slot]
+			inputFrame.Move[slot] = [3]float32{float32(m.x), float32(m.y), float32(m.z)}
+		}
+		runtime.DispatchPlayerInput(&inputFrame)
+	})
+}
+
+// ============================================================
+// V6: Property Watch Export
+// ============================================================
+
+//export GoStrike_OnPropertyChanges
+func GoStrike_OnPropertyChanges(changes *C.gs_watch_change_t, count C.int32_t) {
+	if !initialized || changes == nil || count <= 0 {
+		return
+	}
+
+	_ = safeCall(func() {
+		raw := unsafe.Slice(changes, int(count))
+		batch := make([]shared.WatchChange, len(raw))
+		for i := range raw {
+			c := &raw[i]
+			batch[i] = shared.WatchChange{
+				ID:      int(c.watch_id),
+				Removed: uint32(c.flags)&C.GS_WATCH_REMOVED != 0,
+			}
+			for j := 0; j < shared.WatchValueSize; j++ {
+				batch[i].Old[j] = byte(c.old_value[j])
+				batch[i].New[j] = byte(c.new_value[j])
+			}
+		}
+		runtime.DispatchWatchChanges(batch)
+	})
+}
+
 //export GoStrike_OnMapChange
 func GoStrike_OnMapChange(mapName *C.char) {
 	if !initialized || mapName == nil {
@@ -554,6 +710,7 @@ func convertCPlayer(p *C.gs_player_t) *shared.PlayerInfo {
 	if p.name != nil {
 		player.Name = C.GoString(p.name)
 	}
+
 	if p.ip != nil {
 		player.IP = C.GoString(p.ip)
 	}
@@ -0,0 +1,79 @@
+package bridge
+
+import "testing"
+
+// fakeStringTable stands in for the native string table and counts lookups
+type fakeStringTable struct {
+	strings map[uint32]string
+	lookups int
+}
+
+// installStringTable clears the Go cache and routes lookups to a fake table
+func installStringTable(t *testing.T, strings map[uint32]string) *fakeStringTable {
+	t.Helper()
+	f := &fakeStringTable{strings: strings}
+	saved := nativeString
+	resetInternedStrings()
+	nativeString = func(id uint32) (string, bool) {
+		f.lookups++
+		s, ok := f.strings[id]
+		return s, ok
+	}
+	t.Cleanup(func() {
+		nativeString = saved
+		resetInternedStrings()
+	})
+	return f
+}
+
+// ── interned string tests ─────────────────────────────────────
+
+func TestInternedStringConvertsOnce(t *testing.T) {
+	f := installStringTable(t, map[uint32]string{1: "player_death", 40: "prop_physics"})
+
+	for i := 0; i < 3; i++ {
+		if got := internedString(1); got != "player_death" {
+			t.Fatalf("internedString(1) = %q", got)
+		}
+	}
+	if got := internedString(40); got != "prop_physics" {
+		t.Fatalf("internedString(40) = %q (table growth)", got)
+	}
+	if f.lookups != 2 {
+		t.Fatalf("native lookups = %d, want 2", f.lookups)
+	}
+}
+
+func TestInternedStringZeroAndUnknown(t *testing.T) {
+	f := installStringTable(t, map[uint32]string{})
+
+	if got := internedString(0); got != "" || f.lookups != 0 {
+		t.Fatalf("internedString(0) = %q after %d lookups, want \"\" without a lookup", got, f.lookups)
+	}
+	if got := internedString(7); got != "" {
+		t.Fatalf("unknown ID = %q, want \"\"", got)
+	}
+
+	// An unknown ID is not cached: a later native entry is picked up
+	f.strings[7] = "info_target"
+	if got := internedString(7); got != "info_target" {
+		t.Fatalf("internedString(7) after native intern = %q", got)
+	}
+}
+
+func TestInternedStringResetOnReload(t *testing.T) {
+	f := installStringTable(t, map[uint32]string{1: "weapon_ak47", 2: "round_start"})
+	internedString(1)
+	internedString(2)
+
+	// Plugin reload: the native table restarts and reuses the IDs
+	f.strings = map[uint32]string{1: "round_start", 2: "weapon_ak47"}
+	resetInternedStrings()
+
+	if got := internedString(1); got != "round_start" {
+		t.Fatalf("internedString(1) after reload = %q, want round_start", got)
+	}
+	if got := internedString(2); got != "weapon_ak47" {
+		t.Fatalf("internedString(2) after reload = %q, want weapon_ak47", got)
+	}
+}
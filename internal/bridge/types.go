@@ -25,3 +25,11 @@ const (
 	TeamT          = 2
 	TeamCT         = 3
 )
+
+// EntityRef identifies an entity returned by a bulk native query
+type EntityRef struct {
+	Index     uint32
+	Handle    uint32  // raw CEntityHandle (index + serial)
+	Ptr       uintptr // opaque C++ pointer, never dereferenced in Go
+	ClassName string
+}
@@ -226,7 +226,7 @@ func (m *Module) registerBuiltinRoutes() {
 
 		json.NewEncoder(w).Encode(map[string]interface{}{
 			"version":       "0.1.0",
-			"abi_version":   1,
+			"abi_version":   2,
 			"status":        "running",
 			"modules_count": len(moduleList),
 		})
@@ -4,8 +4,45 @@ package runtime
 
 import (
 	"sync"
+	"sync/atomic"
+
+	"github.com/corrreia/gostrike/internal/shared"
 )
 
+// ============================================================
+// Native Subscriptions
+// ============================================================
+
+// NativeSubscriptions switches native event sources on and off. The bridge
+// installs it at init. The dispatcher calls it when a handler list gains its
+// first handler or loses its last one, and for every live list at shutdown,
+// so native recording is only on while Go has a handler for it.
+type NativeSubscriptions struct {
+	EntityOutput func(handle uint32, output string, enable bool)
+	TriggerTouch func(handle uint32, enable bool)
+	Hook         func(hookID int, post bool, enable bool)
+	InputCapture func(enable bool)
+}
+
+var nativeSubs NativeSubscriptions
+
+// SetNativeSubscriptions installs the native subscription functions
+func SetNativeSubscriptions(subs NativeSubscriptions) {
+	nativeSubs = subs
+}
+
+// removeEntry returns list without entry. Dispatchers iterate a snapshot
+// taken under the read lock, so the result is always a new slice.
+func removeEntry[T any](list []*T, entry *T) []*T {
+	rest := make([]*T, 0, len(list))
+	for _, e := range list {
+		if e != entry {
+			rest = append(rest, e)
+		}
+	}
+	return rest
+}
+
 // ============================================================
 // Tick Dispatching
 // ============================================================
@@ -97,6 +134,11 @@ func initEvents() {
 	entitySpawnedHandlers = nil
 	entityDeletedHandlers = nil
 	damageHandlers = nil
+	entityEventHandlers = make(map[entityHookKey][]*entityEventEntry)
+	itemAcquireHandlers = nil
+	hookHandlers = make(map[int]*[2][]*hookEntry)
+	inputHandlers = nil
+	watchHandlers = make(map[int]watchHandler)
 }
 
 func shutdownEvents() {
@@ -133,6 +175,39 @@ func shutdownEvents() {
 	damageHandlers = nil
 	damageHandlersMu.Unlock()
 
+	entityEventHandlersMu.Lock()
+	for key := range entityEventHandlers {
+		key.subscribe(false)
+	}
+	entityEventHandlers = make(map[entityHookKey][]*entityEventEntry)
+	entityEventHandlersMu.Unlock()
+
+	itemAcquireHandlersMu.Lock()
+	itemAcquireHandlers = nil
+	itemAcquireHandlersMu.Unlock()
+
+	hookHandlersMu.Lock()
+	for hookID, chains := range hookHandlers {
+		for c := range chains {
+			if len(chains[c]) > 0 {
+				subscribeHook(hookID, c == 1, false)
+			}
+		}
+	}
+	hookHandlers = make(map[int]*[2][]*hookEntry)
+	hookHandlersMu.Unlock()
+
+	inputHandlersMu.Lock()
+	if len(inputHandlers) > 0 {
+		subscribeInput(false)
+	}
+	inputHandlers = nil
+	inputHandlersMu.Unlock()
+
+	watchHandlersMu.Lock()
+	watchHandlers = make(map[int]watchHandler)
+	watchHandlersMu.Unlock()
+
 	tickHandlersMu.Lock()
 	tickHandlers = nil
 	tickHandlersMu.Unlock()
@@ -297,8 +372,20 @@ func DispatchPlayerDisconnect(slot int, reason string) {
 	}
 }
 
+// mapGeneration counts map starts, so lazily filled caches can tell when to retry
+var mapGeneration uint64
+
+// MapGeneration returns the number of map starts seen by this process
+func MapGeneration() uint64 {
+	return atomic.LoadUint64(&mapGeneration)
+}
+
 // DispatchMapChange dispatches a map change event
 func DispatchMapChange(mapName string) {
+	atomic.AddUint64(&mapGeneration, 1)
+	// Native code dropped the previous map's per-entity subscriptions
+	dropEntityEventHandlers(allEntities)
+
 	mapChangeHandlersMu.RLock()
 	handlers := mapChangeHandlers
 	mapChangeHandlersMu.RUnlock()
@@ -357,6 +444,8 @@ func DispatchEntitySpawned(index uint32, classname string) {
 
 // DispatchEntityDeleted dispatches an entity deleted event
 func DispatchEntityDeleted(index uint32) {
+	dropEntityEventHandlers(index)
+
 	entityDeletedMu.RLock()
 	handlers := entityDeletedHandlers
 	entityDeletedMu.RUnlock()
@@ -365,3 +454,347 @@ func DispatchEntityDeleted(index uint32) {
 		handler(index)
 	}
 }
+
+// ============================================================
+// Entity Output / Touch Dispatching
+// ============================================================
+
+type entityEventHandler func(event *EntityEvent)
+
+// entityEventEntry wraps a handler so it can be found again for removal
+type entityEventEntry struct {
+	fn entityEventHandler
+}
+
+// entityHookKey identifies a subscription: touches use an empty output name
+type entityHookKey struct {
+	kind   int
+	handle uint32
+	output string
+}
+
+// entityIndexMask extracts the entity index from an entity handle
+const entityIndexMask = 0x7FFF
+
+// allEntities makes dropEntityEventHandlers drop every per-entity key (map change)
+const allEntities = ^uint32(0)
+
+var (
+	entityEventHandlers   = make(map[entityHookKey][]*entityEventEntry)
+	entityEventHandlersMu sync.RWMutex
+)
+
+// subscribe switches the key's native subscription on or off
+func (k entityHookKey) subscribe(enable bool) {
+	if k.kind == shared.EntityEventOutput {
+		if nativeSubs.EntityOutput != nil {
+			nativeSubs.EntityOutput(k.handle, k.output, enable)
+		}
+	} else if nativeSubs.TriggerTouch != nil {
+		nativeSubs.TriggerTouch(k.handle, enable)
+	}
+}
+
+// RegisterEntityEventHandler registers a handler for an entity output or trigger touch.
+// handle may be shared.AnyEntity. The key's first handler subscribes natively.
+// Returns a function that removes the handler again; removing the key's last
+// handler unsubscribes natively.
+func RegisterEntityEventHandler(kind int, handle uint32, output string, handler entityEventHandler) func() {
+	key := entityHookKey{kind: kind, handle: handle, output: output}
+	entry := &entityEventEntry{fn: handler}
+
+	entityEventHandlersMu.Lock()
+	defer entityEventHandlersMu.Unlock()
+	if len(entityEventHandlers[key]) == 0 {
+		key.subscribe(true)
+	}
+	entityEventHandlers[key] = append(entityEventHandlers[key], entry)
+	return func() { removeEntityEventHandler(key, entry) }
+}
+
+func removeEntityEventHandler(key entityHookKey, entry *entityEventEntry) {
+	entityEventHandlersMu.Lock()
+	defer entityEventHandlersMu.Unlock()
+
+	handlers := entityEventHandlers[key]
+	rest := removeEntry(handlers, entry)
+	if len(rest) == len(handlers) {
+		return // already removed: entity deleted, shutdown or a second call
+	}
+	if len(rest) == 0 {
+		delete(entityEventHandlers, key)
+		key.subscribe(false)
+		return
+	}
+	entityEventHandlers[key] = rest
+}
+
+// dropEntityEventHandlers forgets every handler hooked on a deleted entity
+// (allEntities: on any entity, at map change).
+// Native code drops its subscriptions for the entity itself, so nothing is
+// unsubscribed here.
+func dropEntityEventHandlers(index uint32) {
+	entityEventHandlersMu.Lock()
+	defer entityEventHandlersMu.Unlock()
+	for key := range entityEventHandlers {
+		if key.handle != shared.AnyEntity && (index == allEntities || key.handle&entityIndexMask == index) {
+			delete(entityEventHandlers, key)
+		}
+	}
+}
+
+// DispatchEntityEvents dispatches one frame's batch of entity output/touch events
+func DispatchEntityEvents(events []EntityEvent) {
+	for i := range events {
+		ev := &events[i]
+		key := entityHookKey{kind: ev.Kind, handle: ev.Entity.Handle}
+		if ev.Kind == shared.EntityEventOutput {
+			key.output = ev.Output
+		}
+		anyKey := key
+		anyKey.handle = shared.AnyEntity
+
+		entityEventHandlersMu.RLock()
+		handlers := entityEventHandlers[key]
+		anyHandlers := entityEventHandlers[anyKey]
+		entityEventHandlersMu.RUnlock()
+
+		for _, entry := range handlers {
+			entry.fn(ev)
+		}
+		for _, entry := range anyHandlers {
+			entry.fn(ev)
+		}
+	}
+}
+
+// ============================================================
+// Item Acquire Dispatching (escalated CanUse/CanAcquire checks)
+// ============================================================
+
+type itemAcquireHandler func(slot, itemID, method int) int
+
+var (
+	itemAcquireHandlers   []itemAcquireHandler
+	itemAcquireHandlersMu sync.RWMutex
+)
+
+// RegisterItemAcquireHandler registers a handler for escalated item acquisitions
+func RegisterItemAcquireHandler(handler itemAcquireHandler) {
+	itemAcquireHandlersMu.Lock()
+	defer itemAcquireHandlersMu.Unlock()
+	itemAcquireHandlers = append(itemAcquireHandlers, handler)
+}
+
+// DispatchItemAcquire asks the handlers about an acquisition.
+// A result of EventHandled or higher denies it.
+func DispatchItemAcquire(slot, itemID, method int) int {
+	itemAcquireHandlersMu.RLock()
+	handlers := itemAcquireHandlers
+	itemAcquireHandlersMu.RUnlock()
+
+	result := EventContinue
+	for _, handler := range handlers {
+		r := handler(slot, itemID, method)
+		if r > result {
+			result = r
+		}
+		if result >= EventStop {
+			break
+		}
+	}
+	return result
+}
+
+// ============================================================
+// Generic Function Hook Dispatching
+// ============================================================
+
+type hookHandler func(frame *HookFrame) int
+
+// hookEntry wraps a handler so it can be found again for removal
+type hookEntry struct {
+	fn hookHandler
+}
+
+var (
+	hookHandlers   = make(map[int]*[2][]*hookEntry) // hook ID -> [pre, post]
+	hookHandlersMu sync.RWMutex
+)
+
+func subscribeHook(hookID int, post, enable bool) {
+	if nativeSubs.Hook != nil {
+		nativeSubs.Hook(hookID, post, enable)
+	}
+}
+
+func hookChain(post bool) int {
+	if post {
+		return 1
+	}
+	return 0
+}
+
+// RegisterHookHandler registers a handler on a hook's pre or post chain.
+// The chain's first handler subscribes natively. Returns a function that
+// removes the handler again; emptying the chain unsubscribes natively.
+func RegisterHookHandler(hookID int, post bool, handler hookHandler) func() {
+	entry := &hookEntry{fn: handler}
+
+	hookHandlersMu.Lock()
+	defer hookHandlersMu.Unlock()
+
+	chains := hookHandlers[hookID]
+	if chains == nil {
+		chains = &[2][]*hookEntry{}
+		hookHandlers[hookID] = chains
+	}
+	c := hookChain(post)
+	if len(chains[c]) == 0 {
+		subscribeHook(hookID, post, true)
+	}
+	chains[c] = append(chains[c], entry)
+	return func() { removeHookHandler(hookID, post, entry) }
+}
+
+func removeHookHandler(hookID int, post bool, entry *hookEntry) {
+	hookHandlersMu.Lock()
+	defer hookHandlersMu.Unlock()
+
+	chains := hookHandlers[hookID]
+	if chains == nil {
+		return // shutdown already dropped the hook
+	}
+	c := hookChain(post)
+	rest := removeEntry(chains[c], entry)
+	if len(rest) == len(chains[c]) {
+		return // already removed
+	}
+	chains[c] = rest
+	if len(rest) == 0 {
+		subscribeHook(hookID, post, false)
+	}
+}
+
+// DispatchHook runs the Go handlers of one chain; the highest result wins
+func DispatchHook(frame *HookFrame) int {
+	hookHandlersMu.RLock()
+	var handlers []*hookEntry
+	if chains := hookHandlers[frame.HookID]; chains != nil {
+		handlers = chains[hookChain(frame.Post)]
+	}
+	hookHandlersMu.RUnlock()
+
+	result := 0
+	for _, handler := range handlers {
+		if r := handler.fn(frame); r > result {
+			result = r
+		}
+	}
+	return result
+}
+
+// ============================================================
+// Player Input Dispatching
+// ============================================================
+
+type inputHandler func(frame *InputFrame)
+
+// inputEntry wraps a handler so it can be found again for removal
+type inputEntry struct {
+	fn inputHandler
+}
+
+var (
+	inputHandlers   []*inputEntry
+	inputHandlersMu sync.RWMutex
+)
+
+func subscribeInput(enable bool) {
+	if nativeSubs.InputCapture != nil {
+		nativeSubs.InputCapture(enable)
+	}
+}
+
+// RegisterInputHandler registers a handler for per-frame player input.
+// The first handler enables native input capture. Returns a function that
+// removes the handler again; removing the last one disables capture.
+func RegisterInputHandler(handler inputHandler) func() {
+	entry := &inputEntry{fn: handler}
+
+	inputHandlersMu.Lock()
+	defer inputHandlersMu.Unlock()
+	if len(inputHandlers) == 0 {
+		subscribeInput(true)
+	}
+	inputHandlers = append(inputHandlers, entry)
+	return func() { removeInputHandler(entry) }
+}
+
+func removeInputHandler(entry *inputEntry) {
+	inputHandlersMu.Lock()
+	defer inputHandlersMu.Unlock()
+
+	rest := removeEntry(inputHandlers, entry)
+	if len(rest) == len(inputHandlers) {
+		return // already removed: shutdown or a second call
+	}
+	inputHandlers = rest
+	if len(rest) == 0 {
+		subscribeInput(false)
+	}
+}
+
+// DispatchPlayerInput delivers a frame of captured input to every handler
+func DispatchPlayerInput(frame *InputFrame) {
+	inputHandlersMu.RLock()
+	handlers := inputHandlers
+	inputHandlersMu.RUnlock()
+
+	for _, handler := range handlers {
+		handler.fn(frame)
+	}
+}
+
+// ============================================================
+// Property Watch Dispatching
+// ============================================================
+
+type watchHandler func(change *WatchChange)
+
+var (
+	watchHandlers   = make(map[int]watchHandler)
+	watchHandlersMu sync.RWMutex
+)
+
+// RegisterWatchHandler registers the handler for a native watch ID
+func RegisterWatchHandler(id int, handler watchHandler) {
+	watchHandlersMu.Lock()
+	defer watchHandlersMu.Unlock()
+	watchHandlers[id] = handler
+}
+
+// UnregisterWatchHandler removes the handler for a native watch ID
+func UnregisterWatchHandler(id int) {
+	watchHandlersMu.Lock()
+	defer watchHandlersMu.Unlock()
+	delete(watchHandlers, id)
+}
+
+// DispatchWatchChanges delivers a frame's property changes to their handlers.
+// Removed watches are unregistered after their final delivery.
+func DispatchWatchChanges(changes []WatchChange) {
+	for i := range changes {
+		c := &changes[i]
+		watchHandlersMu.RLock()
+		handler := watchHandlers[c.ID]
+		watchHandlersMu.RUnlock()
+
+		if c.Removed {
+			UnregisterWatchHandler(c.ID)
+		}
+		if handler != nil {
+			handler(c)
+		}
+	}
+}
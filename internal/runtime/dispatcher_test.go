@@ -0,0 +1,289 @@
+package runtime
+
+import (
+	"testing"
+
+	"github.com/corrreia/gostrike/internal/shared"
+)
+
+// nativeRecorder stands in for the bridge and tracks native subscription
+// reference counts per key.
+type nativeRecorder struct {
+	outputs map[entityHookKey]int
+	touches map[uint32]int
+	hooks   map[hookRef]int
+	input   int
+}
+
+type hookRef struct {
+	id   int
+	post bool
+}
+
+// installRecorder resets the dispatcher and routes native subscriptions to a recorder
+func installRecorder(t *testing.T) *nativeRecorder {
+	t.Helper()
+	r := &nativeRecorder{
+		outputs: make(map[entityHookKey]int),
+		touches: make(map[uint32]int),
+		hooks:   make(map[hookRef]int),
+	}
+	initEvents()
+	SetNativeSubscriptions(NativeSubscriptions{
+		EntityOutput: func(handle uint32, output string, enable bool) {
+			key := entityHookKey{kind: shared.EntityEventOutput, handle: handle, output: output}
+			r.outputs[key] += delta(enable)
+		},
+		TriggerTouch: func(handle uint32, enable bool) {
+			r.touches[handle] += delta(enable)
+		},
+		Hook: func(hookID int, post, enable bool) {
+			r.hooks[hookRef{hookID, post}] += delta(enable)
+		},
+		InputCapture: func(enable bool) {
+			r.input += delta(enable)
+		},
+	})
+	t.Cleanup(func() {
+		SetNativeSubscriptions(NativeSubscriptions{})
+		initEvents()
+	})
+	return r
+}
+
+func delta(enable bool) int {
+	if enable {
+		return 1
+	}
+	return -1
+}
+
+// ── entity event tests ────────────────────────────────────────
+
+func TestEntityEventSubscribeOncePerKey(t *testing.T) {
+	r := installRecorder(t)
+	key := entityHookKey{kind: shared.EntityEventOutput, handle: 0x10005, output: "OnPressed"}
+
+	calls := 0
+	unhookA := RegisterEntityEventHandler(key.kind, key.handle, key.output, func(*EntityEvent) { calls++ })
+	unhookB := RegisterEntityEventHandler(key.kind, key.handle, key.output, func(*EntityEvent) { calls++ })
+	if r.outputs[key] != 1 {
+		t.Fatalf("native refs after two handlers = %d, want 1", r.outputs[key])
+	}
+
+	DispatchEntityEvents([]EntityEvent{{Kind: key.kind, Entity: shared.EntityEventRef{Handle: key.handle}, Output: key.output}})
+	if calls != 2 {
+		t.Fatalf("handlers called %d times, want 2", calls)
+	}
+
+	unhookA()
+	if r.outputs[key] != 1 {
+		t.Fatalf("native refs after first unhook = %d, want 1", r.outputs[key])
+	}
+	unhookA() // second call is a no-op
+	unhookB()
+	if r.outputs[key] != 0 {
+		t.Fatalf("native refs after last unhook = %d, want 0", r.outputs[key])
+	}
+
+	calls = 0
+	DispatchEntityEvents([]EntityEvent{{Kind: key.kind, Entity: shared.EntityEventRef{Handle: key.handle}, Output: key.output}})
+	if calls != 0 {
+		t.Fatalf("removed handlers called %d times", calls)
+	}
+}
+
+func TestEntityEventTouchKindsShareNativeRefs(t *testing.T) {
+	r := installRecorder(t)
+	const trigger = 0x20007
+
+	unhookStart := RegisterEntityEventHandler(shared.EntityEventStartTouch, trigger, "", func(*EntityEvent) {})
+	unhookEnd := RegisterEntityEventHandler(shared.EntityEventEndTouch, trigger, "", func(*EntityEvent) {})
+	if r.touches[trigger] != 2 {
+		t.Fatalf("native touch refs = %d, want 2", r.touches[trigger])
+	}
+	unhookStart()
+	unhookEnd()
+	if r.touches[trigger] != 0 {
+		t.Fatalf("native touch refs after unhook = %d, want 0", r.touches[trigger])
+	}
+}
+
+func TestEntityEventDeleteDropsHandlers(t *testing.T) {
+	r := installRecorder(t)
+	const handle = 0x30042 // index 0x42
+	key := entityHookKey{kind: shared.EntityEventOutput, handle: handle, output: "OnBreak"}
+
+	calls := 0
+	unhook := RegisterEntityEventHandler(key.kind, handle, key.output, func(*EntityEvent) { calls++ })
+	RegisterEntityEventHandler(key.kind, shared.AnyEntity, key.output, func(*EntityEvent) {})
+
+	DispatchEntityDeleted(handle & entityIndexMask)
+	if _, ok := entityEventHandlers[key]; ok {
+		t.Fatal("handlers of a deleted entity were kept")
+	}
+	if _, ok := entityEventHandlers[entityHookKey{kind: key.kind, handle: shared.AnyEntity, output: key.output}]; !ok {
+		t.Fatal("any-entity handlers were dropped with the entity")
+	}
+
+	// Native code already dropped the entity's subscription; unhook must not
+	// release it a second time.
+	unhook()
+	if r.outputs[key] != 1 {
+		t.Fatalf("native refs after unhook of deleted entity = %d, want 1 (left to native)", r.outputs[key])
+	}
+
+	DispatchEntityEvents([]EntityEvent{{Kind: key.kind, Entity: shared.EntityEventRef{Handle: handle}, Output: key.output}})
+	if calls != 0 {
+		t.Fatalf("handler of a deleted entity called %d times", calls)
+	}
+}
+
+func TestEntityEventMapChangeDropsEntityHandlers(t *testing.T) {
+	r := installRecorder(t)
+	key := entityHookKey{kind: shared.EntityEventOutput, handle: 0x10009, output: "OnTrigger"}
+	anyKey := entityHookKey{kind: shared.EntityEventStartTouch, handle: shared.AnyEntity}
+
+	unhook := RegisterEntityEventHandler(key.kind, key.handle, key.output, func(*EntityEvent) {})
+	RegisterEntityEventHandler(anyKey.kind, anyKey.handle, "", func(*EntityEvent) {})
+
+	DispatchMapChange("de_dust2")
+	if _, ok := entityEventHandlers[key]; ok {
+		t.Fatal("per-entity handlers survived the map change")
+	}
+	if _, ok := entityEventHandlers[anyKey]; !ok {
+		t.Fatal("any-entity handlers were dropped at map change")
+	}
+
+	// Native code already dropped the subscription at map end
+	unhook()
+	if r.outputs[key] != 1 {
+		t.Fatalf("native refs after stale unhook = %d, want 1 (left to native)", r.outputs[key])
+	}
+}
+
+func TestEntityEventShutdownUnsubscribes(t *testing.T) {
+	r := installRecorder(t)
+	key := entityHookKey{kind: shared.EntityEventOutput, handle: 0x10001, output: "OnTrigger"}
+
+	unhook := RegisterEntityEventHandler(key.kind, key.handle, key.output, func(*EntityEvent) {})
+	RegisterEntityEventHandler(shared.EntityEventStartTouch, shared.AnyEntity, "", func(*EntityEvent) {})
+
+	shutdownEvents()
+	if r.outputs[key] != 0 || r.touches[shared.AnyEntity] != 0 {
+		t.Fatalf("native refs after shutdown = %d outputs, %d touches, want 0",
+			r.outputs[key], r.touches[shared.AnyEntity])
+	}
+
+	unhook() // stale unhook after shutdown is a no-op
+	if r.outputs[key] != 0 {
+		t.Fatalf("stale unhook changed native refs to %d", r.outputs[key])
+	}
+}
+
+// ── function hook tests ───────────────────────────────────────
+
+func TestHookChainSubscribesWhileNonEmpty(t *testing.T) {
+	r := installRecorder(t)
+	pre, post := hookRef{3, false}, hookRef{3, true}
+
+	calls := 0
+	unhookA := RegisterHookHandler(3, false, func(*HookFrame) int { calls++; return 0 })
+	unhookB := RegisterHookHandler(3, false, func(*HookFrame) int { calls++; return 2 })
+	unhookPost := RegisterHookHandler(3, true, func(*HookFrame) int { return 0 })
+	if r.hooks[pre] != 1 || r.hooks[post] != 1 {
+		t.Fatalf("native refs = pre %d, post %d, want 1 each", r.hooks[pre], r.hooks[post])
+	}
+
+	if got := DispatchHook(&HookFrame{HookID: 3}); got != 2 || calls != 2 {
+		t.Fatalf("DispatchHook = %d after %d calls, want 2 after 2", got, calls)
+	}
+
+	unhookA()
+	unhookA() // second call is a no-op
+	if r.hooks[pre] != 1 {
+		t.Fatalf("pre refs after first unhook = %d, want 1", r.hooks[pre])
+	}
+	unhookB()
+	if r.hooks[pre] != 0 || r.hooks[post] != 1 {
+		t.Fatalf("native refs after emptying pre = pre %d, post %d, want 0 and 1", r.hooks[pre], r.hooks[post])
+	}
+
+	calls = 0
+	if got := DispatchHook(&HookFrame{HookID: 3}); got != 0 || calls != 0 {
+		t.Fatalf("removed handlers ran: result %d, %d calls", got, calls)
+	}
+	unhookPost()
+	if r.hooks[post] != 0 {
+		t.Fatalf("post refs after unhook = %d, want 0", r.hooks[post])
+	}
+}
+
+func TestHookShutdownUnsubscribes(t *testing.T) {
+	r := installRecorder(t)
+
+	unhook := RegisterHookHandler(5, true, func(*HookFrame) int { return 0 })
+	RegisterHookHandler(6, false, func(*HookFrame) int { return 0 })
+	emptied := RegisterHookHandler(7, false, func(*HookFrame) int { return 0 })
+	emptied()
+
+	shutdownEvents()
+	for ref, n := range r.hooks {
+		if n != 0 {
+			t.Fatalf("native refs for hook %d (post=%v) after shutdown = %d, want 0", ref.id, ref.post, n)
+		}
+	}
+
+	unhook() // stale unhook after shutdown is a no-op
+	if n := r.hooks[hookRef{5, true}]; n != 0 {
+		t.Fatalf("stale unhook changed native refs to %d", n)
+	}
+}
+
+// ── input capture tests ───────────────────────────────────────
+
+func TestInputCaptureFollowsHandlers(t *testing.T) {
+	r := installRecorder(t)
+
+	calls := 0
+	unhookA := RegisterInputHandler(func(*InputFrame) { calls++ })
+	unhookB := RegisterInputHandler(func(*InputFrame) { calls++ })
+	if r.input != 1 {
+		t.Fatalf("capture refs after two handlers = %d, want 1", r.input)
+	}
+
+	DispatchPlayerInput(&InputFrame{})
+	if calls != 2 {
+		t.Fatalf("handlers called %d times, want 2", calls)
+	}
+
+	unhookA()
+	unhookA() // second call is a no-op
+	if r.input != 1 {
+		t.Fatalf("capture refs after first unhook = %d, want 1", r.input)
+	}
+	unhookB()
+	if r.input != 0 {
+		t.Fatalf("capture refs after last unhook = %d, want 0", r.input)
+	}
+}
+
+func TestInputCaptureShutdownReleases(t *testing.T) {
+	r := installRecorder(t)
+
+	unhook := RegisterInputHandler(func(*InputFrame) {})
+	shutdownEvents()
+	if r.input != 0 {
+		t.Fatalf("capture refs after shutdown = %d, want 0", r.input)
+	}
+	unhook() // stale unhook after shutdown is a no-op
+	if r.input != 0 {
+		t.Fatalf("stale unhook changed capture refs to %d", r.input)
+	}
+
+	// A fresh registration after shutdown captures again
+	RegisterInputHandler(func(*InputFrame) {})
+	if r.input != 1 {
+		t.Fatalf("capture refs after re-register = %d, want 1", r.input)
+	}
+}
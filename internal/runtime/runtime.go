@@ -11,6 +11,18 @@ import (
 // PlayerInfo contains player information
 type PlayerInfo = shared.PlayerInfo
 
+// EntityEvent is a subscribed entity output or trigger touch
+type EntityEvent = shared.EntityEvent
+
+// HookFrame is the argument frame passed to generic function hook handlers
+type HookFrame = shared.HookFrame
+
+// InputFrame is a frame of captured player input
+type InputFrame = shared.InputFrame
+
+// WatchChange is a changed property watch value
+type WatchChange = shared.WatchChange
+
 var (
 	initialized bool
 	initMu      sync.Mutex
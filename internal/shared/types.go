@@ -200,6 +200,73 @@ type PlayerInfo struct {
 	PosZ    float64
 }
 
+// ============================================================
+// Entity Hook Events
+// ============================================================
+
+// Entity hook event kinds matching C++ gs_entity_event_kind_t
+const (
+	EntityEventOutput     = 0
+	EntityEventStartTouch = 1
+	EntityEventEndTouch   = 2
+)
+
+// AnyEntity subscribes to every entity (GS_INVALID_HANDLE)
+const AnyEntity uint32 = 0xFFFFFFFF
+
+// EntityEventRef identifies an entity in an entity hook event
+type EntityEventRef struct {
+	Index     uint32
+	Handle    uint32
+	Ptr       uintptr // 0 if there is no entity or it was deleted
+	ClassName string
+}
+
+// EntityEvent is a subscribed entity output or trigger touch
+type EntityEvent struct {
+	Kind   int
+	Entity EntityEventRef // output owner / trigger
+	Other  EntityEventRef // activator / touching entity
+	Output string         // output name (outputs only)
+	Delay  float32        // output delay in seconds (outputs only)
+}
+
+// HookFrame is the argument frame of a hooked native call. Args and Ret alias
+// native memory and are only valid for the duration of the handler call.
+type HookFrame struct {
+	HookID     int
+	Post       bool
+	Superceded bool
+	Args       []uint64 // declared order; INT32 sign-extended, FLOAT as IEEE bits
+	Ret        *uint64
+}
+
+// MaxInputPlayers is the number of slots in an InputFrame
+const MaxInputPlayers = 64
+
+// InputFrame holds the player inputs captured since the last frame, one array
+// per field indexed by slot. Only slots whose bit is set in Valid were captured.
+type InputFrame struct {
+	Frame      int32
+	Valid      uint64
+	Buttons    [MaxInputPlayers]uint64
+	ViewAngles [MaxInputPlayers][3]float32
+	Move       [MaxInputPlayers][3]float32 // forward, left, up
+}
+
+// WatchValueSize is the size of a property watch value in bytes
+const WatchValueSize = 16
+
+// WatchChange is one watched property that changed during a frame.
+// Old and New hold the raw field bytes, zero-padded. Removed means the entity
+// is gone and the watch has been dropped.
+type WatchChange struct {
+	ID      int
+	Removed bool
+	Old     [WatchValueSize]byte
+	New     [WatchValueSize]byte
+}
+
 // InitFunc is the type for initialization functions
 type InitFunc func()
 
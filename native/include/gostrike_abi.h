@@ -18,7 +18,7 @@ extern "C" {
 
 // Version for ABI compatibility checks
 // Increment this when making breaking changes to the ABI
-#define GOSTRIKE_ABI_VERSION 1
+#define GOSTRIKE_ABI_VERSION 2
 
 // GoStrike version string
 #define GOSTRIKE_VERSION "0.1.0"
@@ -99,6 +99,7 @@ typedef struct {
     uint32_t    name_len;       // Length of event name
     void*       native_event;   // Opaque pointer to IGameEvent
     bool        can_modify;     // true for pre-hooks
+    uint32_t    name_id;        // Interned event name (see string_get)
 } gs_event_t;
 
 // ============================================================
@@ -162,8 +163,9 @@ void GoStrike_OnMapChange(char* map_name);
 bool GoStrike_OnChatMessage(int32_t player_slot, char* message);
 
 // === V2: Entity lifecycle events (called by C++ entity listener) ===
-void GoStrike_OnEntityCreated(uint32_t index, char* classname);
-void GoStrike_OnEntitySpawned(uint32_t index, char* classname);
+// classname_id is an interned string ID (see string_get)
+void GoStrike_OnEntityCreated(uint32_t index, uint32_t classname_id);
+void GoStrike_OnEntitySpawned(uint32_t index, uint32_t classname_id);
 void GoStrike_OnEntityDeleted(uint32_t index);
 
 // === V5: Damage hook (called by C++ funchook detour) ===
@@ -234,7 +236,8 @@ typedef void (*gs_send_center_t)(int32_t slot, const char* msg);
 // Returns offset in bytes, or 0 if not found. Sets is_networked output.
 typedef int32_t (*gs_schema_get_offset_t)(const char* class_name, const char* field_name, bool* is_networked);
 
-// Schema: notify engine that a networked field changed
+// Schema: notify engine that a networked field changed.
+// Notifications are coalesced and sent once per field at the end of the frame.
 typedef void (*gs_schema_set_state_changed_t)(void* entity, const char* class_name, const char* field_name, int32_t offset);
 
 // Entity property read/write (entity_ptr is opaque, never dereferenced by Go)
@@ -254,7 +257,7 @@ typedef uint32_t (*gs_get_entity_index_t)(void* entity);
 typedef const char* (*gs_get_entity_classname_t)(void* entity);
 typedef bool (*gs_is_entity_valid_t)(void* entity);
 
-// GameData: resolve a signature name to an address
+// GameData: resolve a signature name to an address (after its "address" steps)
 typedef void* (*gs_resolve_gamedata_t)(const char* name);
 // GameData: get an offset by name
 typedef int32_t (*gs_get_gamedata_offset_t)(const char* name);
@@ -316,6 +319,465 @@ typedef void     (*gs_event_set_string_t)(void* event, const char* key, const ch
 typedef void (*gs_give_named_item_t)(int32_t slot, const char* item_name);
 typedef void (*gs_player_drop_weapons_t)(int32_t slot);
 
+// ============================================================
+// V6 Callback Types (Batched Native Subsystems)
+// ============================================================
+
+// Raw CEntityHandle value that never refers to an entity
+#define GS_INVALID_HANDLE 0xFFFFFFFFu
+
+// Entity reference returned by bulk entity queries
+typedef struct {
+    uint32_t    index;      // Entity index
+    uint32_t    handle;     // Raw CEntityHandle (index + serial), GS_INVALID_HANDLE if none
+    void*       entity;     // Opaque CEntityInstance*
+    const char* classname;  // Interned designer name, owned by the engine
+} gs_entity_ref_t;
+
+// Find all live entities whose classname matches.
+// prefix: treat classname as a prefix ("weapon_"); a trailing '*' has the same effect
+// out: caller-allocated array of max_out refs
+// Returns the total number of matches, which may exceed max_out (only max_out are written)
+typedef int32_t (*gs_find_entities_by_classname_t)(const char* classname, bool prefix,
+                                                   gs_entity_ref_t* out, int32_t max_out);
+
+// Get the raw CEntityHandle of an entity (GS_INVALID_HANDLE if invalid)
+typedef uint32_t (*gs_get_entity_handle_t)(void* entity);
+
+// Key/value pair applied to an entity before it spawns
+typedef struct {
+    const char* key;
+    const char* value;
+} gs_keyvalue_t;
+
+// Entity spawn specification
+typedef struct {
+    const char*          classname;       // Entity class to create (required)
+    const char*          model;           // Model path, NULL to skip
+    gs_vector3_t         origin;
+    gs_vector3_t         angles;
+    const gs_keyvalue_t* keyvalues;       // Extra spawn key-values, may be NULL
+    int32_t              keyvalue_count;
+} gs_spawn_spec_t;
+
+// Create, configure and DispatchSpawn a batch of entities (game thread only).
+// out: caller-allocated array of count refs; failed entries get index 0,
+//      handle GS_INVALID_HANDLE and a NULL entity
+// Returns the number of entities spawned successfully
+typedef int32_t (*gs_spawn_entities_t)(const gs_spawn_spec_t* specs, int32_t count, gs_entity_ref_t* out);
+
+// Remove a batch of entities by handle via UTIL_Remove (game thread only).
+// Stale handles are skipped. Returns the number of entities removed.
+typedef int32_t (*gs_remove_entities_t)(const uint32_t* handles, int32_t count);
+
+// Entity input request (AcceptInput / AddEntityIOEvent)
+typedef struct {
+    uint32_t    target;     // Target entity handle
+    const char* input;      // Input name, e.g. "Open", "Toggle", "Kill"
+    const char* value;      // Optional string parameter, NULL for none
+    uint32_t    activator;  // Activator handle, GS_INVALID_HANDLE for none
+    uint32_t    caller;     // Caller handle, GS_INVALID_HANDLE for none
+    float       delay;      // Seconds; <= 0 fires immediately, otherwise queued as an I/O event
+} gs_input_req_t;
+
+// Fire a batch of entity inputs (game thread only).
+// Returns the number of requests dispatched (stale targets are skipped)
+typedef int32_t (*gs_fire_inputs_t)(const gs_input_req_t* reqs, int32_t count);
+
+// Entity hook event kinds
+typedef enum {
+    GS_ENTITY_EVENT_OUTPUT      = 0,  // Entity fired a subscribed output
+    GS_ENTITY_EVENT_START_TOUCH = 1,  // Entity started touching a subscribed trigger
+    GS_ENTITY_EVENT_END_TOUCH   = 2,  // Entity stopped touching a subscribed trigger
+} gs_entity_event_kind_t;
+
+// Entity hook event, delivered to Go in per-frame batches
+// Refs are resolved from handles at flush time, so entities deleted later in the
+// frame arrive with a NULL entity pointer instead of a dangling one.
+typedef struct {
+    int32_t         kind;    // gs_entity_event_kind_t
+    gs_entity_ref_t entity;  // Output owner / trigger
+    gs_entity_ref_t other;   // Activator / touching entity (entity NULL if none)
+    const char*     output;  // Output name (OUTPUT only), owned by the engine
+    float           delay;   // Output delay in seconds (OUTPUT only)
+} gs_entity_event_t;
+
+// Go export: deliver one frame's subscribed output/touch events (called by C++ once per frame)
+// Note: events is non-const because Go CGO exports don't support const
+void GoStrike_OnEntityEvents(gs_entity_event_t* events, int32_t count);
+
+// Subscribe to (or unsubscribe from) an entity output. Subscriptions are
+// reference counted: each enable must be matched by one disable.
+// handle: entity handle, or GS_INVALID_HANDLE for every entity firing that output
+typedef void (*gs_subscribe_entity_output_t)(uint32_t handle, const char* output, bool enable);
+
+// Subscribe to (or unsubscribe from) StartTouch/EndTouch on a trigger.
+// Reference counted like subscribe_entity_output.
+// handle: trigger handle, or GS_INVALID_HANDLE for every trigger
+typedef void (*gs_subscribe_trigger_touch_t)(uint32_t handle, bool enable);
+
+// Hide (hidden=true) or unhide entity indices from a player's transmit set.
+// slot: viewer player slot, -1 for every player. Applied natively in CheckTransmit.
+typedef void (*gs_transmit_set_hidden_t)(int32_t slot, const uint32_t* indices, int32_t count, bool hidden);
+
+// Unhide every entity for a player (slot -1 = every player)
+typedef void (*gs_transmit_clear_t)(int32_t slot);
+
+// Line-of-sight visibility sweep configuration
+typedef struct {
+    int32_t interval_ticks;         // Start a new sweep every N ticks, 0 disables the subsystem
+    int32_t budget_us;              // Trace time budget per tick in microseconds (<= 0: 500)
+    float   max_distance;           // Pairs farther apart are never visible, 0 = unlimited
+    float   fov_degrees;            // Viewer field of view for frustum culling of the matrix, 0 = disabled
+    bool    transmit_hide_enemies;  // Drop enemy pawns a player cannot see in CheckTransmit
+                                    // (distance + padded line of sight; the FOV is ignored)
+} gs_visibility_config_t;
+
+// Replace the visibility sweep configuration. Sweeps need engine traces and do
+// not run while trace_available() is false.
+typedef void (*gs_visibility_configure_t)(const gs_visibility_config_t* config);
+
+// Copy the last completed 64x64 visibility matrix into out_rows[64]:
+// bit j of row i is set if slot i can see slot j.
+// Returns the sweep generation (0 = no sweep completed yet)
+typedef int32_t (*gs_visibility_get_matrix_t)(uint64_t* out_rows);
+
+// Trace content bits (CS2 interaction layers)
+#define GS_TRACE_CONTENTS_SOLID          (1ull << 0)
+#define GS_TRACE_CONTENTS_HITBOX         (1ull << 1)
+#define GS_TRACE_CONTENTS_TRIGGER        (1ull << 2)
+#define GS_TRACE_CONTENTS_SKY            (1ull << 3)
+#define GS_TRACE_CONTENTS_PLAYER_CLIP    (1ull << 4)
+#define GS_TRACE_CONTENTS_BLOCK_LOS      (1ull << 6)
+#define GS_TRACE_CONTENTS_WINDOW         (1ull << 12)
+#define GS_TRACE_CONTENTS_WORLD_GEOMETRY (1ull << 14)
+#define GS_TRACE_CONTENTS_WATER          (1ull << 15)
+#define GS_TRACE_CONTENTS_PLAYER         (1ull << 18)
+#define GS_TRACE_CONTENTS_NPC            (1ull << 19)
+#define GS_TRACE_CONTENTS_DEBRIS         (1ull << 20)
+#define GS_TRACE_CONTENTS_PHYSICS_PROP   (1ull << 21)
+
+// Trace batch flags
+#define GS_TRACE_ANY_HIT (1u << 0)  // Stop at the first ray that hits; later results are left empty
+
+// Ray for a batched trace. A zero mins/maxs box makes it a line trace.
+typedef struct {
+    gs_vector3_t start;
+    gs_vector3_t end;
+    gs_vector3_t mins;
+    gs_vector3_t maxs;
+    uint32_t     ignore;  // Entity handle to pass through, GS_INVALID_HANDLE for none
+} gs_ray_t;
+
+// Result of one traced ray
+typedef struct {
+    bool            hit;
+    bool            start_solid;
+    float           fraction;  // 0..1 along start -> end
+    gs_vector3_t    end;       // Final position
+    gs_vector3_t    normal;    // Surface normal at the hit
+    gs_entity_ref_t entity;    // Hit entity (entity NULL for world or no hit)
+} gs_trace_result_t;
+
+// Trace a batch of rays against geometry matching mask (game thread only).
+// out: n results, may be NULL when only the hit count matters.
+// Returns the number of rays that hit (with GS_TRACE_ANY_HIT: 0 or 1).
+typedef int32_t (*gs_trace_batch_t)(const gs_ray_t* rays, int32_t n, uint64_t mask, uint32_t flags,
+                                    gs_trace_result_t* out);
+
+// Whether engine traces work (TracePlayerBBox resolved from gamedata). While
+// false, trace_batch returns no results and visibility sweeps do not run.
+typedef bool (*gs_trace_available_t)(void);
+
+// Player operation kinds for batched submission
+typedef enum {
+    GS_PLAYER_OP_RESPAWN    = 0,  // Respawn via controller
+    GS_PLAYER_OP_TELEPORT   = 1,  // Teleport pawn (fields selected by flags)
+    GS_PLAYER_OP_SET_HEALTH = 2,  // Set pawn health to value
+    GS_PLAYER_OP_SET_ARMOR  = 3,  // Set pawn armor to value
+    GS_PLAYER_OP_STRIP      = 4,  // Remove all weapons
+    GS_PLAYER_OP_GIVE_ITEM  = 5,  // Give item (one op per item; by item ID in value when item is NULL)
+    GS_PLAYER_OP_SET_TEAM   = 6,  // Change team to value
+} gs_player_op_kind_t;
+
+// Teleport flags: which vectors of a GS_PLAYER_OP_TELEPORT are applied
+#define GS_PLAYER_OP_ORIGIN   (1u << 0)
+#define GS_PLAYER_OP_ANGLES   (1u << 1)
+#define GS_PLAYER_OP_VELOCITY (1u << 2)
+
+// One queued player operation
+typedef struct {
+    int32_t      kind;      // gs_player_op_kind_t
+    int32_t      slot;      // Player slot
+    int32_t      value;     // Health, armor or team
+    uint32_t     flags;     // GS_PLAYER_OP_ORIGIN/ANGLES/VELOCITY for teleports
+    gs_vector3_t origin;
+    gs_vector3_t angles;
+    gs_vector3_t velocity;
+    const char*  item;      // Item name for GS_PLAYER_OP_GIVE_ITEM, NULL to give item ID value
+} gs_player_op_t;
+
+// Execute player operations in order (game thread only).
+// Controller, pawn and item services are resolved once per slot per submission.
+// Returns the number of operations that were applied.
+typedef int32_t (*gs_player_ops_submit_t)(const gs_player_op_t* ops, int32_t n);
+
+// Compact item ID returned for unknown item names
+#define GS_ITEM_INVALID (-1)
+
+// Item definition and cached weapon data (CCSWeaponBaseVData)
+typedef struct {
+    int32_t     item_id;       // Compact registry ID (0..count-1)
+    int32_t     def_index;     // Item definition index
+    const char* classname;     // "weapon_ak47" (static, never freed)
+    void*       vdata;         // CCSWeaponBaseVData*, NULL if not (yet) available
+    int32_t     price;
+    int32_t     kill_award;
+    int32_t     max_clip1;
+    int32_t     reserve_ammo;
+    int32_t     gear_slot;     // gear_slot_t
+    int32_t     weapon_type;   // CSWeaponType
+} gs_weapon_info_t;
+
+// Copy the weapon registry into out (up to max entries). Returns the number written.
+typedef int32_t (*gs_weapon_list_t)(gs_weapon_info_t* out, int32_t max);
+
+// Give items by registry ID (game thread only). Returns the number given.
+typedef int32_t (*gs_give_items_t)(int32_t slot, const int32_t* item_ids, int32_t n);
+
+// Item restriction rule kinds
+typedef enum {
+    GS_ITEM_RULE_TEAM_DENY = 0,  // target = team; deny the items to the whole team
+    GS_ITEM_RULE_SLOT_DENY = 1,  // target = slot; deny the items to one player
+    GS_ITEM_RULE_ESCALATE  = 2,  // target = team; ask Go (GoStrike_OnItemAcquire)
+} gs_item_rule_t;
+
+// How a player is acquiring an item
+typedef enum {
+    GS_ACQUIRE_PICKUP = 0,  // CanAcquire: picking up
+    GS_ACQUIRE_BUY    = 1,  // CanAcquire: buying
+    GS_ACQUIRE_USE    = 2,  // CanUse: touching/using a dropped weapon
+} gs_acquire_method_t;
+
+// Go export: decide an escalated acquisition (called by C++ from the CanUse/CanAcquire hooks).
+// Return GS_EVENT_HANDLED or higher to deny.
+gs_event_result_t GoStrike_OnItemAcquire(int32_t slot, int32_t item_id, int32_t method);
+
+// Set or clear a rule for a list of item IDs
+typedef void (*gs_item_rules_set_t)(int32_t rule, int32_t target, const int32_t* item_ids, int32_t n, bool enable);
+
+// Per-team item limit (-1 = unlimited) and the team's current holder count
+typedef void (*gs_item_set_limit_t)(int32_t team, int32_t item_id, int32_t limit);
+typedef void (*gs_item_set_count_t)(int32_t team, int32_t item_id, int32_t count);
+
+// Drop all item rules, limits and counts
+typedef void (*gs_item_rules_clear_t)(void);
+
+// Maximum declared arguments for a generic function hook
+#define GS_HOOK_MAX_ARGS 14
+
+// Argument/return types for generic function hooks.
+// VECTOR is a pointer to a Vector (const Vector& / Vector*).
+typedef enum {
+    GS_HOOK_TYPE_VOID    = 0,  // Return type only
+    GS_HOOK_TYPE_INT32   = 1,
+    GS_HOOK_TYPE_INT64   = 2,
+    GS_HOOK_TYPE_POINTER = 3,
+    GS_HOOK_TYPE_FLOAT   = 4,
+    GS_HOOK_TYPE_DOUBLE  = 5,
+    GS_HOOK_TYPE_BOOL    = 6,
+    GS_HOOK_TYPE_VECTOR  = 7,
+} gs_hook_type_t;
+
+// Handler results; the highest result of a chain wins
+typedef enum {
+    GS_HOOK_CONTINUE  = 0,  // Nothing changed
+    GS_HOOK_CHANGED   = 1,  // Pre: args were modified; post: ret was modified
+    GS_HOOK_SUPERCEDE = 2,  // Pre only: skip the original and return frame ret
+} gs_hook_result_t;
+
+// Argument frame shared by every handler of one call
+typedef struct {
+    int32_t  hook_id;
+    int32_t  argc;
+    bool     post;                     // Running the post chain
+    bool     superceded;               // The original was skipped
+    uint64_t args[GS_HOOK_MAX_ARGS];   // Declared order; INT32 sign-extended, FLOAT as IEEE bits
+    uint64_t ret;                      // Return value (post, or set by a superceding pre handler)
+} gs_hook_frame_t;
+
+// Go export: run Go's handlers for a hooked call (called by C++ on the game thread)
+gs_hook_result_t GoStrike_OnHook(gs_hook_frame_t* frame);
+
+// Define a hook on a gamedata signature. Detours are installed together on the next frame.
+// Returns the hook ID, or -1 on failure.
+typedef int32_t (*gs_hook_define_t)(const char* name, int32_t ret_type, const int32_t* arg_types, int32_t argc);
+
+// Reference-counted subscription of Go to a hook's pre or post chain
+typedef void (*gs_hook_subscribe_t)(int32_t hook_id, bool post, bool enable);
+
+// Describe a callable native function using the gs_hook_type_t codes (VECTOR not allowed
+// as ret_type). name: gamedata signature or offset entry; vtable_index >= 0 makes it a
+// virtual call on the first (POINTER) argument. Returns the call ID, or -1 on failure.
+typedef int32_t (*gs_call_define_t)(const char* name, int32_t vtable_index, int32_t ret_type,
+                                    const int32_t* arg_types, int32_t argc);
+
+// Invoke a defined function. args: one slot per argument (INT32 sign-extended, FLOAT as
+// IEEE bits, VECTOR as an index into vectors). ret receives the normalized return value.
+typedef bool (*gs_call_invoke_t)(int32_t call_id, const uint64_t* args, const gs_vector3_t* vectors, uint64_t* ret);
+
+// Player slots covered by per-tick input frames
+#define GS_INPUT_MAX_PLAYERS 64
+
+// Player input captured from CCSPlayerPawnBase::PostThink, one column per field (SoA).
+// Only slots whose bit is set in valid were captured since the last delivery.
+typedef struct {
+    int32_t      frame;                                 // Server frame counter at delivery
+    uint64_t     valid;                                 // Bit per slot
+    uint64_t     buttons[GS_INPUT_MAX_PLAYERS];         // CInButtonState button mask (InputBitMask_t)
+    gs_vector3_t view_angles[GS_INPUT_MAX_PLAYERS];     // v_angle (pitch, yaw, roll)
+    gs_vector3_t move[GS_INPUT_MAX_PLAYERS];            // Forward, left, up move
+} gs_input_frame_t;
+
+// Go export: receive the inputs captured since the last frame (optional)
+// Note: frame is non-const because Go CGO exports don't support const
+void GoStrike_OnPlayerInput(gs_input_frame_t* frame);
+
+// Reference-counted input capture. Capturing costs one pawn read per PostThink.
+typedef void (*gs_input_capture_t)(bool enable);
+
+// Ticks of state kept per player (2 seconds at 64 tick)
+#define GS_HISTORY_TICKS 128
+
+// Player state at a (possibly fractional) tick, interpolated from the history ring
+typedef struct {
+    int32_t      slot;
+    bool         valid;         // false: no samples around the requested tick
+    gs_vector3_t origin;
+    gs_vector3_t eye_angles;    // Pitch, yaw, roll
+    gs_vector3_t velocity;
+    uint32_t     flags;         // m_fFlags of the earlier sample
+} gs_player_sample_t;
+
+// Interpolated state of count slots at tick. out: caller-allocated, count entries.
+// Returns the number of valid samples.
+typedef int32_t (*gs_history_query_t)(const int32_t* slots, int32_t count, float tick, gs_player_sample_t* out);
+
+// Newest recorded tick (-1 if none yet)
+typedef int32_t (*gs_history_latest_tick_t)(void);
+
+// Bytes compared and reported per watched property (scalars, handles, vectors)
+#define GS_WATCH_VALUE_SIZE 16
+
+// The watched entity is gone; the watch has been removed
+#define GS_WATCH_REMOVED 0x1
+
+// A watched property that changed since the previous frame. Values are the raw
+// field bytes, zero-padded to GS_WATCH_VALUE_SIZE.
+typedef struct {
+    int32_t  watch_id;
+    uint32_t flags;                             // GS_WATCH_* flags
+    uint8_t  old_value[GS_WATCH_VALUE_SIZE];
+    uint8_t  new_value[GS_WATCH_VALUE_SIZE];
+} gs_watch_change_t;
+
+// Go export: receive a frame's property changes in one batch (optional)
+// Note: changes is non-const because Go CGO exports don't support const
+void GoStrike_OnPropertyChanges(gs_watch_change_t* changes, int32_t count);
+
+// Watch size bytes (1..GS_WATCH_VALUE_SIZE) of a schema field on an entity.
+// Returns the watch ID, or -1 if the entity or field is unknown.
+typedef int32_t (*gs_watch_add_t)(uint32_t entity_handle, const char* class_name, const char* field_name, int32_t size);
+
+// Stop watching
+typedef void (*gs_watch_remove_t)(int32_t watch_id);
+
+// Largest value a field path read returns per entity (e.g. char[128] names)
+#define GS_PATH_MAX_VALUE 256
+
+// Compile a field path into a reusable ID. A path is a chain of Class.field
+// steps joined by "->", where "->" follows the pointer stored in the field:
+//   "CBaseEntity.m_CBodyComponent->CBodyComponent.m_pSceneNode->CGameSceneNode.m_vecAbsOrigin"
+// Compiling the same path again returns the same ID. Returns -1 on error.
+typedef int32_t (*gs_path_compile_t)(const char* path);
+
+// Read size bytes (1..GS_PATH_MAX_VALUE) at the end of a compiled path for many
+// entities. out receives count*size bytes; valid[i] is false (and the value
+// zeroed) when the entity is gone or a pointer along the path is null.
+// Returns the number of valid entries.
+typedef int32_t (*gs_path_read_t)(int32_t path_id, const uint32_t* entity_handles, int32_t count,
+                                  int32_t size, uint8_t* out, bool* valid);
+
+// Array field layouts for entity_read_array / entity_read_handles
+#define GS_ARRAY_FIXED      0   // inline T field[N]; length is passed by the caller
+#define GS_ARRAY_UTLVECTOR  1   // CUtlVector<T> / CNetworkUtlVectorBase<T>; length is read from the field
+
+// Copy the elements of an array field into out in one call. kind: GS_ARRAY_*.
+// If field_name is NULL or empty, class_name is a field path (see path_compile)
+// that ends at the array field, e.g. on a component.
+// length is the declared element count for GS_ARRAY_FIXED (ignored otherwise).
+// At most max_count elements of elem_size bytes are copied. Returns the element
+// count, which may exceed max_count, or -1 if the field is unknown.
+typedef int32_t (*gs_entity_read_array_t)(void* entity, const char* class_name, const char* field_name,
+                                          int32_t kind, int32_t length, int32_t elem_size,
+                                          void* out, int32_t max_count);
+
+// Like entity_read_array for an array of CHandle elements, with each handle
+// resolved natively. Stale or empty handles yield a ref with handle
+// GS_INVALID_HANDLE and a NULL entity, keeping positions aligned.
+typedef int32_t (*gs_entity_read_handles_t)(void* entity, const char* class_name, const char* field_name,
+                                            int32_t kind, int32_t length,
+                                            gs_entity_ref_t* out, int32_t max_count);
+
+// Interned strings: classnames and event names cross the ABI as stable IDs.
+// Returns the string for an ID (valid until plugin unload), or NULL for 0 or
+// an unknown ID. IDs restart after a reload, so Go drops its copies at init.
+typedef const char* (*gs_string_get_t)(uint32_t id);
+
+// Interned classname of an entity, or 0 if the entity is NULL
+typedef uint32_t (*gs_entity_classname_id_t)(void* entity);
+
+// Round end reasons for TerminateRound (CS2 RoundEndReason)
+typedef enum {
+    GS_ROUND_END_TARGET_BOMBED          = 1,
+    GS_ROUND_END_TERRORISTS_ESCAPED     = 4,
+    GS_ROUND_END_CTS_PREVENT_ESCAPE     = 5,
+    GS_ROUND_END_ESCAPERS_NEUTRALIZED   = 6,
+    GS_ROUND_END_BOMB_DEFUSED           = 7,
+    GS_ROUND_END_CTS_WIN                = 8,
+    GS_ROUND_END_TERRORISTS_WIN         = 9,
+    GS_ROUND_END_DRAW                   = 10,
+    GS_ROUND_END_HOSTAGES_RESCUED       = 11,
+    GS_ROUND_END_TARGET_SAVED           = 12,
+    GS_ROUND_END_HOSTAGES_NOT_RESCUED   = 13,
+    GS_ROUND_END_TERRORISTS_NOT_ESCAPED = 14,
+    GS_ROUND_END_GAME_COMMENCING        = 16,
+    GS_ROUND_END_TERRORISTS_SURRENDER   = 17,
+    GS_ROUND_END_CTS_SURRENDER          = 18,
+} gs_round_end_reason_t;
+
+// Round state snapshot, refreshed once per game frame from CCSGameRules and the team entities
+typedef struct {
+    void*   gamerules;          // CCSGameRules* (schema reads), NULL between maps
+    bool    warmup;             // m_bWarmupPeriod
+    bool    freeze_period;      // m_bFreezePeriod
+    bool    bomb_planted;       // m_bBombPlanted
+    int32_t game_phase;         // m_gamePhase
+    int32_t rounds_played;      // m_totalRoundsPlayed
+    int32_t round_time;         // m_iRoundTime (seconds)
+    float   round_start_time;   // m_fRoundStartTime (server time)
+    float   warmup_end;         // m_fWarmupPeriodEnd (server time)
+    int32_t win_reason;         // m_eRoundWinReason of the last round
+    int32_t score_t;            // CTeam m_iScore of team 2
+    int32_t score_ct;           // CTeam m_iScore of team 3
+} gs_gamerules_t;
+
+// Current round state (game thread; the pointer stays valid, contents change per frame)
+typedef const gs_gamerules_t* (*gs_get_gamerules_t)(void);
+
+// End the round via CCSGameRules::TerminateRound. Returns false without gamerules.
+typedef bool (*gs_terminate_round_t)(float delay, int32_t reason);
+
 // ============================================================
 // Callback Registry
 // ============================================================
@@ -410,6 +872,82 @@ typedef struct {
     // Weapon management
     gs_give_named_item_t        give_named_item;
     gs_player_drop_weapons_t    player_drop_weapons;
+
+    // === V6 (Batched Native Subsystems) ===
+    // Entity queries
+    gs_find_entities_by_classname_t find_entities_by_classname;
+    gs_get_entity_handle_t          get_entity_handle;
+
+    // Entity spawning
+    gs_spawn_entities_t             spawn_entities;
+    gs_remove_entities_t            remove_entities;
+
+    // Entity I/O
+    gs_fire_inputs_t                fire_inputs;
+
+    // Entity output / trigger touch subscriptions
+    gs_subscribe_entity_output_t    subscribe_entity_output;
+    gs_subscribe_trigger_touch_t    subscribe_trigger_touch;
+
+    // Per-player transmit filtering
+    gs_transmit_set_hidden_t        transmit_set_hidden;
+    gs_transmit_clear_t             transmit_clear;
+
+    // Line-of-sight visibility
+    gs_visibility_configure_t       visibility_configure;
+    gs_visibility_get_matrix_t      visibility_get_matrix;
+
+    // Engine traces
+    gs_trace_batch_t                trace_batch;
+    gs_trace_available_t            trace_available;
+
+    // Batched player operations
+    gs_player_ops_submit_t          player_ops_submit;
+
+    // Weapon registry
+    gs_weapon_list_t                weapon_list;
+    gs_give_items_t                 give_items;
+
+    // Weapon pickup/acquire restrictions
+    gs_item_rules_set_t             item_rules_set;
+    gs_item_set_limit_t             item_set_limit;
+    gs_item_set_count_t             item_set_count;
+    gs_item_rules_clear_t           item_rules_clear;
+
+    // Generic function hooks
+    gs_hook_define_t                hook_define;
+    gs_hook_subscribe_t             hook_subscribe;
+
+    // Native function calls
+    gs_call_define_t                call_define;
+    gs_call_invoke_t                call_invoke;
+
+    // Gamerules
+    gs_get_gamerules_t              get_gamerules;
+    gs_terminate_round_t            terminate_round;
+
+    // Player input capture
+    gs_input_capture_t              input_capture;
+
+    // Player state history
+    gs_history_query_t              history_query;
+    gs_history_latest_tick_t        history_latest_tick;
+
+    // Property watchers
+    gs_watch_add_t                  watch_add;
+    gs_watch_remove_t               watch_remove;
+
+    // Field paths
+    gs_path_compile_t               path_compile;
+    gs_path_read_t                  path_read;
+
+    // Array fields
+    gs_entity_read_array_t          entity_read_array;
+    gs_entity_read_handles_t        entity_read_handles;
+
+    // Interned strings
+    gs_string_get_t                 string_get;
+    gs_entity_classname_id_t        entity_classname_id;
 } gs_callbacks_t;
 
 // Register callbacks from C++ to Go
@@ -0,0 +1,105 @@
+// entity_arrays.cpp - Bulk reads of array and CUtlVector schema fields
+//
+// Both CUtlVector<T> and CNetworkUtlVectorBase<T> start with the element
+// count followed by the element pointer, which is all a read needs. Element
+// counts are bounded so a wrong layout or kind cannot run away.
+
+#include "entity_arrays.h"
+#include "entity_system.h"
+#include "field_path.h"
+#include "schema.h"
+
+#include <cstring>
+
+namespace gostrike {
+
+static constexpr int32_t kMaxElements = 4096;
+
+// Leading members of CUtlVector / CNetworkUtlVectorBase
+struct UtlVectorHeader {
+    int32_t size;
+    int32_t pad;
+    const uint8_t* elements;
+};
+
+// Locate an array field's elements and count. Returns false if the field is
+// unknown or, for a path, a pointer along it is null.
+static bool LocateArray(void* entity, const char* className, const char* fieldName,
+                        int32_t kind, int32_t length,
+                        const uint8_t** elements, int32_t* count) {
+    if (!entity || !className) return false;
+
+    const uint8_t* field;
+    if (fieldName && *fieldName) {
+        int32_t offset = schema::GetOffset(className, fieldName).offset;
+        if (offset <= 0) return false;
+        field = static_cast<const uint8_t*>(entity) + offset;
+    } else {
+        // className is a field path; compiling a known path is a map lookup
+        field = static_cast<const uint8_t*>(FieldPath_Resolve(FieldPath_Compile(className), entity));
+        if (!field) return false;
+    }
+
+    if (kind == GS_ARRAY_FIXED) {
+        if (length < 0 || length > kMaxElements) return false;
+        *elements = field;
+        *count = length;
+        return true;
+    }
+    if (kind == GS_ARRAY_UTLVECTOR) {
+        UtlVectorHeader header;
+        memcpy(&header, field, sizeof(header));
+        if (header.size < 0 || header.size > kMaxElements) return false;
+        *elements = header.elements;
+        *count = header.elements ? header.size : 0;
+        return true;
+    }
+    return false;
+}
+
+int32_t EntityArray_Read(void* entity, const char* className, const char* fieldName,
+                         int32_t kind, int32_t length, int32_t elemSize,
+                         void* out, int32_t maxCount) {
+    if (elemSize <= 0) return -1;
+
+    const uint8_t* elements = nullptr;
+    int32_t count = 0;
+    if (!LocateArray(entity, className, fieldName, kind, length, &elements, &count)) return -1;
+
+    int32_t copy = count < maxCount ? count : maxCount;
+    if (out && copy > 0) {
+        memcpy(out, elements, static_cast<size_t>(copy) * elemSize);
+    }
+    return count;
+}
+
+int32_t EntityArray_ReadHandles(void* entity, const char* className, const char* fieldName,
+                                int32_t kind, int32_t length,
+                                gs_entity_ref_t* out, int32_t maxCount) {
+    const uint8_t* elements = nullptr;
+    int32_t count = 0;
+    if (!LocateArray(entity, className, fieldName, kind, length, &elements, &count)) return -1;
+
+    int32_t copy = count < maxCount ? count : maxCount;
+    for (int32_t i = 0; out && i < copy; i++) {
+        uint32_t handle;
+        memcpy(&handle, elements + static_cast<size_t>(i) * sizeof(uint32_t), sizeof(handle));
+
+        gs_entity_ref_t& ref = out[i];
+        void* target = EntitySystem_GetEntityByHandle(handle);
+        if (target) {
+            ref.index = EntitySystem_GetEntityIndex(target);
+            ref.handle = handle;
+            ref.entity = target;
+            ref.classname = EntitySystem_GetEntityClassname(target);
+        } else {
+            ref.index = 0;
+            ref.handle = GS_INVALID_HANDLE;
+            ref.entity = nullptr;
+            ref.classname = nullptr;
+        }
+    }
+    return count;
+}
+
+} // namespace gostrike
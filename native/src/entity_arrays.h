@@ -0,0 +1,26 @@
+// entity_arrays.h - Bulk reads of array and CUtlVector schema fields
+// Copies a whole inline array or CUtlVector field in one call, optionally
+// resolving CHandle elements to entity refs natively. The field can also be
+// named by a field path, for arrays that live on a component.
+
+#ifndef GOSTRIKE_ENTITY_ARRAYS_H
+#define GOSTRIKE_ENTITY_ARRAYS_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// See gs_entity_read_array_t. Returns the element count or -1.
+int32_t EntityArray_Read(void* entity, const char* className, const char* fieldName,
+                         int32_t kind, int32_t length, int32_t elemSize,
+                         void* out, int32_t maxCount);
+
+// See gs_entity_read_handles_t. Returns the element count or -1.
+int32_t EntityArray_ReadHandles(void* entity, const char* className, const char* fieldName,
+                                int32_t kind, int32_t length,
+                                gs_entity_ref_t* out, int32_t maxCount);
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_ENTITY_ARRAYS_H
@@ -0,0 +1,327 @@
+// entity_hooks.cpp - Entity output and trigger touch hooks
+// Hook targets and CEntityIOOutput layout follow CounterStrikeSharp's entity output hooks.
+//
+// The detours run for every output and every touch on the map, so the hot path is
+// kept to a couple of hash lookups: output names are matched by their interned
+// EntityIOOutputDesc_t name pointer (memoized), and nothing crosses into Go until
+// EntityHooks_Flush() hands over the whole frame's events in one call.
+
+#include "entity_hooks.h"
+#include "gameconfig.h"
+#include "entity_system.h"
+#include "go_bridge.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <funchook.h>
+
+namespace gostrike {
+
+// ============================================================
+// Subscriptions
+// ============================================================
+
+// Subscription reference counts per entity handle (GS_INVALID_HANDLE = any entity).
+// An entry exists only while its count is positive.
+using SubCounts = std::unordered_map<uint32_t, int32_t>;
+
+// output name -> subscribed entity handles
+static std::unordered_map<std::string, SubCounts> s_outputSubs;
+// Desc name pointer -> entry in s_outputSubs (nullptr if unsubscribed); cleared on change
+static std::unordered_map<const char*, const SubCounts*> s_outputNameMemo;
+// Subscribed trigger handles; start and end touch hooks share one count
+static SubCounts s_touchSubs;
+
+// Events recorded this frame
+static std::vector<gs_entity_event_t> s_pendingEvents;
+// (trigger << 32 | other) pairs already recorded this frame, per touch kind
+static std::unordered_set<uint64_t> s_pendingStartTouch;
+static std::unordered_set<uint64_t> s_pendingEndTouch;
+
+// Add or release one reference; returns true if the entry was created or removed
+static bool UpdateSubCount(SubCounts& subs, uint32_t handle, bool enable) {
+    if (enable) return ++subs[handle] == 1;
+
+    auto it = subs.find(handle);
+    if (it == subs.end()) return false;  // already dropped (entity deleted)
+    if (--it->second > 0) return false;
+    subs.erase(it);
+    return true;
+}
+
+void EntityHooks_SubscribeOutput(uint32_t handle, const char* output, bool enable) {
+    if (!output || output[0] == '\0') return;
+
+    if (enable) {
+        if (UpdateSubCount(s_outputSubs[output], handle, true)) s_outputNameMemo.clear();
+        return;
+    }
+    auto it = s_outputSubs.find(output);
+    if (it == s_outputSubs.end()) return;
+    if (UpdateSubCount(it->second, handle, false) && it->second.empty()) {
+        s_outputSubs.erase(it);
+        s_outputNameMemo.clear();
+    }
+}
+
+void EntityHooks_SubscribeTouch(uint32_t handle, bool enable) {
+    UpdateSubCount(s_touchSubs, handle, enable);
+}
+
+void EntityHooks_OnEntityDeleted(uint32_t handle) {
+    if (handle == GS_INVALID_HANDLE) return;
+    s_touchSubs.erase(handle);
+    for (auto it = s_outputSubs.begin(); it != s_outputSubs.end();) {
+        it->second.erase(handle);
+        if (it->second.empty()) {
+            it = s_outputSubs.erase(it);
+            s_outputNameMemo.clear();
+        } else {
+            ++it;
+        }
+    }
+}
+
+// Erase every count except the any-entity one
+static void DropEntitySubs(SubCounts& subs) {
+    for (auto it = subs.begin(); it != subs.end();) {
+        if (it->first == GS_INVALID_HANDLE) {
+            ++it;
+        } else {
+            it = subs.erase(it);
+        }
+    }
+}
+
+void EntityHooks_OnMapEnd() {
+    DropEntitySubs(s_touchSubs);
+    for (auto it = s_outputSubs.begin(); it != s_outputSubs.end();) {
+        DropEntitySubs(it->second);
+        if (it->second.empty()) {
+            it = s_outputSubs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    s_outputNameMemo.clear();
+    s_pendingEvents.clear();
+    s_pendingStartTouch.clear();
+    s_pendingEndTouch.clear();
+}
+
+#ifndef USE_STUB_SDK
+static const SubCounts* FindOutputSubs(const char* name) {
+    auto memo = s_outputNameMemo.find(name);
+    if (memo != s_outputNameMemo.end()) return memo->second;
+
+    auto it = s_outputSubs.find(name);
+    const SubCounts* subs = (it != s_outputSubs.end()) ? &it->second : nullptr;
+    s_outputNameMemo.emplace(name, subs);
+    return subs;
+}
+
+static void RecordTouch(int32_t kind, void* trigger, void* other) {
+    uint32_t triggerHandle = EntitySystem_GetEntityHandle(trigger);
+    if (!s_touchSubs.count(triggerHandle) && !s_touchSubs.count(GS_INVALID_HANDLE)) return;
+
+    uint32_t otherHandle = EntitySystem_GetEntityHandle(other);
+    uint64_t pair = (static_cast<uint64_t>(triggerHandle) << 32) | otherHandle;
+    auto& seen = (kind == GS_ENTITY_EVENT_START_TOUCH) ? s_pendingStartTouch : s_pendingEndTouch;
+    if (!seen.insert(pair).second) return;  // same touch already recorded this frame
+
+    gs_entity_event_t ev = {};
+    ev.kind = kind;
+    ev.entity.handle = triggerHandle;
+    ev.other.handle = otherHandle;
+    ev.output = nullptr;
+    ev.delay = 0.0f;
+    s_pendingEvents.push_back(ev);
+}
+#endif
+
+// ============================================================
+// Detours
+// ============================================================
+
+#ifndef USE_STUB_SDK
+// Minimal mirrors of the engine's output structures (CounterStrikeSharp layout)
+struct GsEntityIOOutputDesc {
+    const char* m_pName;
+    uint32_t m_nFlags;
+    uint32_t m_nOutputOffset;
+};
+
+struct GsEntityIOOutput {
+    void* vtable;
+    void* m_pConnections;
+    GsEntityIOOutputDesc* m_pDesc;
+};
+
+// void CEntityIOOutput::FireOutputInternal(CEntityInstance* pActivator, CEntityInstance* pCaller,
+//                                          const CVariant* value, float flDelay)
+typedef void (*FireOutputInternalFn)(GsEntityIOOutput*, void*, void*, const void*, float);
+// void CBaseTrigger::StartTouch(CBaseEntity* pOther) / EndTouch(CBaseEntity* pOther)
+typedef void (*TriggerTouchFn)(void*, void*);
+
+static FireOutputInternalFn s_pOriginalFireOutput = nullptr;
+static TriggerTouchFn s_pOriginalStartTouch = nullptr;
+static TriggerTouchFn s_pOriginalEndTouch = nullptr;
+static funchook_t* s_pEntityHooks = nullptr;
+
+static void DetourFireOutputInternal(GsEntityIOOutput* pThis, void* pActivator, void* pCaller,
+                                     const void* value, float flDelay) {
+    if (!s_outputSubs.empty() && pThis && pThis->m_pDesc && pThis->m_pDesc->m_pName && pCaller) {
+        const SubCounts* subs = FindOutputSubs(pThis->m_pDesc->m_pName);
+        if (subs) {
+            uint32_t callerHandle = EntitySystem_GetEntityHandle(pCaller);
+            if (subs->count(callerHandle) || subs->count(GS_INVALID_HANDLE)) {
+                gs_entity_event_t ev = {};
+                ev.kind = GS_ENTITY_EVENT_OUTPUT;
+                ev.entity.handle = callerHandle;
+                ev.other.handle = pActivator ? EntitySystem_GetEntityHandle(pActivator) : GS_INVALID_HANDLE;
+                ev.output = pThis->m_pDesc->m_pName;
+                ev.delay = flDelay;
+                s_pendingEvents.push_back(ev);
+            }
+        }
+    }
+
+    s_pOriginalFireOutput(pThis, pActivator, pCaller, value, flDelay);
+}
+
+static void DetourStartTouch(void* pThis, void* pOther) {
+    if (!s_touchSubs.empty() && pThis && pOther) {
+        RecordTouch(GS_ENTITY_EVENT_START_TOUCH, pThis, pOther);
+    }
+    s_pOriginalStartTouch(pThis, pOther);
+}
+
+static void DetourEndTouch(void* pThis, void* pOther) {
+    if (!s_touchSubs.empty() && pThis && pOther) {
+        RecordTouch(GS_ENTITY_EVENT_END_TOUCH, pThis, pOther);
+    }
+    s_pOriginalEndTouch(pThis, pOther);
+}
+
+// Prepare one detour on the shared funchook instance. Returns false if skipped.
+static bool PrepareDetour(const char* name, void** original, void* detour) {
+    void* addr = g_gameConfig.ResolveSignature(name);
+    if (!addr) {
+        printf("[GoStrike] EntityHooks: %s signature not found\n", name);
+        return false;
+    }
+
+    *original = addr;
+    int rv = funchook_prepare(s_pEntityHooks, original, detour);
+    if (rv != 0) {
+        printf("[GoStrike] EntityHooks: funchook_prepare(%s) failed: %s\n",
+               name, funchook_error_message(s_pEntityHooks));
+        *original = nullptr;
+        return false;
+    }
+    return true;
+}
+#endif
+
+void EntityHooks_Initialize() {
+#ifndef USE_STUB_SDK
+    s_pEntityHooks = funchook_create();
+    if (!s_pEntityHooks) {
+        printf("[GoStrike] EntityHooks: funchook_create() failed\n");
+        return;
+    }
+
+    int prepared = 0;
+    prepared += PrepareDetour("CEntityIOOutput_FireOutputInternal",
+                              (void**)&s_pOriginalFireOutput, (void*)&DetourFireOutputInternal);
+    prepared += PrepareDetour("CBaseTrigger_StartTouch",
+                              (void**)&s_pOriginalStartTouch, (void*)&DetourStartTouch);
+    prepared += PrepareDetour("CBaseTrigger_EndTouch",
+                              (void**)&s_pOriginalEndTouch, (void*)&DetourEndTouch);
+
+    if (prepared == 0 || funchook_install(s_pEntityHooks, 0) != 0) {
+        if (prepared > 0) {
+            printf("[GoStrike] EntityHooks: funchook_install() failed: %s\n",
+                   funchook_error_message(s_pEntityHooks));
+        }
+        funchook_destroy(s_pEntityHooks);
+        s_pEntityHooks = nullptr;
+        s_pOriginalFireOutput = nullptr;
+        s_pOriginalStartTouch = nullptr;
+        s_pOriginalEndTouch = nullptr;
+        return;
+    }
+
+    printf("[GoStrike] EntityHooks: %d/3 output/touch hooks installed\n", prepared);
+#else
+    printf("[GoStrike] EntityHooks: stub mode, output/touch hooks disabled\n");
+#endif
+}
+
+void EntityHooks_Shutdown() {
+#ifndef USE_STUB_SDK
+    if (s_pEntityHooks) {
+        funchook_uninstall(s_pEntityHooks, 0);
+        funchook_destroy(s_pEntityHooks);
+        s_pEntityHooks = nullptr;
+        s_pOriginalFireOutput = nullptr;
+        s_pOriginalStartTouch = nullptr;
+        s_pOriginalEndTouch = nullptr;
+        printf("[GoStrike] EntityHooks: hooks removed\n");
+    }
+#endif
+    s_outputSubs.clear();
+    s_outputNameMemo.clear();
+    s_touchSubs.clear();
+    s_pendingEvents.clear();
+    s_pendingStartTouch.clear();
+    s_pendingEndTouch.clear();
+}
+
+// Resolve a recorded handle into a full ref (entity stays NULL if it is gone)
+static void ResolveRef(gs_entity_ref_t& ref) {
+    ref.entity = EntitySystem_GetEntityByHandle(ref.handle);
+    if (ref.entity) {
+        ref.index = EntitySystem_GetEntityIndex(ref.entity);
+        ref.classname = EntitySystem_GetEntityClassname(ref.entity);
+    } else {
+        ref.index = 0;
+        ref.classname = nullptr;
+    }
+}
+
+void EntityHooks_Flush() {
+    if (s_pendingEvents.empty()) return;
+
+    // Swap out first: Go handlers may fire inputs that trigger further outputs,
+    // which are then recorded for the next frame instead of mutating this batch.
+    std::vector<gs_entity_event_t> events;
+    events.swap(s_pendingEvents);
+    s_pendingStartTouch.clear();
+    s_pendingEndTouch.clear();
+
+    // Drop events whose owner/trigger was deleted since it was recorded
+    size_t live = 0;
+    for (gs_entity_event_t& ev : events) {
+        ResolveRef(ev.entity);
+        if (!ev.entity.entity) continue;
+        ResolveRef(ev.other);
+        events[live++] = ev;
+    }
+    events.resize(live);
+
+    if (!events.empty()) {
+        GoBridge_OnEntityEvents(events.data(), static_cast<int32_t>(events.size()));
+    }
+
+    // Hand the buffer back so its capacity is reused next frame
+    events.clear();
+    if (s_pendingEvents.empty()) s_pendingEvents.swap(events);
+}
+
+} // namespace gostrike
@@ -0,0 +1,42 @@
+// entity_hooks.h - Entity output and trigger touch hooks
+// Detours CEntityIOOutput_FireOutputInternal, CBaseTrigger_StartTouch and
+// CBaseTrigger_EndTouch (funchook). Only subscribed entities/outputs are
+// recorded, and recorded events are flushed to Go once per frame.
+
+#ifndef GOSTRIKE_ENTITY_HOOKS_H
+#define GOSTRIKE_ENTITY_HOOKS_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Install the output/touch detours
+void EntityHooks_Initialize();
+
+// Remove the detours and drop all subscriptions and pending events
+void EntityHooks_Shutdown();
+
+// Add or release a reference on an output subscription; recording stops when
+// the last reference is released.
+// handle: entity handle, or GS_INVALID_HANDLE for every entity with that output
+void EntityHooks_SubscribeOutput(uint32_t handle, const char* output, bool enable);
+
+// Add or release a reference on a trigger's touch subscription.
+// handle: trigger handle, or GS_INVALID_HANDLE for every trigger
+void EntityHooks_SubscribeTouch(uint32_t handle, bool enable);
+
+// Drop every subscription (all references) for an entity that is being deleted
+void EntityHooks_OnEntityDeleted(uint32_t handle);
+
+// Drop every per-entity subscription and unflushed event (map end). Handles
+// from the previous map must not match entities of the next one; any-entity
+// subscriptions are kept.
+void EntityHooks_OnMapEnd();
+
+// Deliver this frame's recorded events to Go in one call (game thread, once per frame)
+void EntityHooks_Flush();
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_ENTITY_HOOKS_H
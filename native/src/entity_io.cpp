@@ -0,0 +1,102 @@
+// entity_io.cpp - Entity input firing (AcceptInput / AddEntityIOEvent)
+// Call shapes follow CounterStrikeSharp / CS2Fixes:
+//   CEntityInstance::AcceptInput(input, activator, caller, variant_t*, outputId)
+//   CEntitySystem::AddEntityIOEvent(target, input, activator, caller, variant_t*, delay, outputId)
+
+#include "entity_io.h"
+#include "gostrike.h"
+#include "gameconfig.h"
+#include "entity_system.h"
+
+#include <cstdio>
+#include <string>
+#include <unordered_set>
+
+#ifndef USE_STUB_SDK
+#include <entity2/entityinstance.h>
+#include <entity2/entitysystem.h>
+#include <variant.h>
+#endif
+
+namespace gostrike {
+
+#ifndef USE_STUB_SDK
+typedef void (*AcceptInputFn)(CEntityInstance*, const char*, CEntityInstance*, CEntityInstance*,
+                              variant_t*, int);
+typedef void (*AddEntityIOEventFn)(CEntitySystem*, CEntityInstance*, const char*, CEntityInstance*,
+                                   CEntityInstance*, variant_t*, float, int);
+
+static AcceptInputFn s_fnAcceptInput = nullptr;
+static AddEntityIOEventFn s_fnAddEntityIOEvent = nullptr;
+#endif
+
+// Interned input names. Queued I/O events keep the raw input name pointer
+// until they fire, so it must outlive the call. Input names are a small fixed
+// vocabulary ("Open", "Enable", "Kill", ...); parameter values are not
+// interned (see EntityIO_FireInputs).
+static std::unordered_set<std::string> s_internedStrings;
+
+static const char* InternString(const char* str) {
+    if (!str) return nullptr;
+    return s_internedStrings.emplace(str).first->c_str();
+}
+
+void EntityIO_Initialize() {
+#ifndef USE_STUB_SDK
+    s_fnAcceptInput = reinterpret_cast<AcceptInputFn>(
+        g_gameConfig.ResolveSignature("CEntityInstance_AcceptInput"));
+    s_fnAddEntityIOEvent = reinterpret_cast<AddEntityIOEventFn>(
+        g_gameConfig.ResolveSignature("CEntitySystem_AddEntityIOEvent"));
+
+    printf("[GoStrike] EntityIO: initialized (accept=%p, queue=%p)\n",
+           (void*)s_fnAcceptInput, (void*)s_fnAddEntityIOEvent);
+#else
+    printf("[GoStrike] EntityIO: stub mode, entity inputs disabled\n");
+#endif
+}
+
+void EntityIO_Shutdown() {
+    s_internedStrings.clear();
+}
+
+int32_t EntityIO_FireInputs(const gs_input_req_t* reqs, int32_t count) {
+    if (!reqs || count <= 0) return 0;
+
+#ifndef USE_STUB_SDK
+    CEntitySystem* pEntitySystem = static_cast<CEntitySystem*>(EntitySystem_GetSystemPtr());
+
+    int32_t fired = 0;
+    for (int32_t i = 0; i < count; i++) {
+        const gs_input_req_t& req = reqs[i];
+        if (!req.input || req.input[0] == '\0') continue;
+
+        auto* pTarget = static_cast<CEntityInstance*>(EntitySystem_GetEntityByHandle(req.target));
+        if (!pTarget) continue;
+
+        auto* pActivator = static_cast<CEntityInstance*>(EntitySystem_GetEntityByHandle(req.activator));
+        auto* pCaller = static_cast<CEntityInstance*>(EntitySystem_GetEntityByHandle(req.caller));
+        const char* pszInput = InternString(req.input);
+
+        if (req.delay <= 0.0f) {
+            if (!s_fnAcceptInput) continue;
+            variant_t value = req.value ? variant_t(req.value) : variant_t();
+            s_fnAcceptInput(pTarget, pszInput, pActivator, pCaller, &value, 0);
+        } else {
+            if (!s_fnAddEntityIOEvent || !pEntitySystem) continue;
+            // The parameter is copied into engine-allocated variant storage, which
+            // the queued event owns and frees when it fires or is cancelled.
+            variant_t value;
+            if (req.value) value.SetString(req.value, true);
+            s_fnAddEntityIOEvent(pEntitySystem, pTarget, pszInput, pActivator, pCaller,
+                                 &value, req.delay, 0);
+        }
+        fired++;
+    }
+    return fired;
+#else
+    (void)InternString;
+    return 0;
+#endif
+}
+
+} // namespace gostrike
@@ -0,0 +1,27 @@
+// entity_io.h - Entity input firing (AcceptInput / AddEntityIOEvent)
+// Uses CEntityInstance_AcceptInput and CEntitySystem_AddEntityIOEvent from gamedata.
+// Call shapes follow CounterStrikeSharp / CS2Fixes entity I/O helpers.
+
+#ifndef GOSTRIKE_ENTITY_IO_H
+#define GOSTRIKE_ENTITY_IO_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Resolve the I/O functions from gamedata
+void EntityIO_Initialize();
+
+// Release interned input names
+void EntityIO_Shutdown();
+
+// Fire a batch of inputs (game thread only).
+// Requests with delay <= 0 go straight to AcceptInput; the rest are queued
+// on the engine's I/O event queue via AddEntityIOEvent.
+// Returns the number of requests dispatched.
+int32_t EntityIO_FireInputs(const gs_input_req_t* reqs, int32_t count);
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_ENTITY_IO_H
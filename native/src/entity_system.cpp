@@ -6,8 +6,14 @@
 #include "gostrike.h"
 #include "gameconfig.h"
 #include "go_bridge.h"
+#include "entity_hooks.h"
+#include "transmit_manager.h"
+#include "visibility_manager.h"
 
 #include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
 
 #ifndef USE_STUB_SDK
 #include <entity2/entitysystem.h>
@@ -28,14 +34,14 @@ static CGameEntitySystem* s_pEntitySystem = nullptr;
 
 namespace gostrike {
 
-void EntitySystem_Initialize() {
 #ifndef USE_STUB_SDK
+// Read CGameEntitySystem out of CGameResourceService
+static CGameEntitySystem* ReadEntitySystem() {
     if (!gs_pGameResourceService) {
         printf("[GoStrike] EntitySystem: CGameResourceService not available\n");
-        return;
+        return nullptr;
     }
 
-    // Get the entity system using the gamedata offset
     // IGameResourceService is only forward-declared in the SDK, so we use offset
     int offset = g_gameConfig.GetOffset("GameEntitySystem");
     if (offset < 0) {
@@ -44,22 +50,41 @@ void EntitySystem_Initialize() {
         printf("[GoStrike] EntitySystem: using fallback offset %d for GameEntitySystem\n", offset);
     }
 
-    s_pEntitySystem = *reinterpret_cast<CGameEntitySystem**>(
+    auto* pEntitySystem = *reinterpret_cast<CGameEntitySystem**>(
         reinterpret_cast<uintptr_t>(gs_pGameResourceService) + offset);
-
-    if (!s_pEntitySystem) {
+    if (!pEntitySystem) {
         printf("[GoStrike] EntitySystem: CGameEntitySystem not available at offset %d\n", offset);
-        return;
     }
+    return pEntitySystem;
+}
+#endif
 
-    // Register our entity listener
-    s_pEntitySystem->AddListenerEntity(&s_entityListener);
-    printf("[GoStrike] EntitySystem: initialized at %p, entity listener registered\n", s_pEntitySystem);
+void EntitySystem_Initialize() {
+#ifndef USE_STUB_SDK
+    EntitySystem_Refresh();
 #else
     printf("[GoStrike] EntitySystem: stub mode, no entity tracking\n");
 #endif
 }
 
+void EntitySystem_Refresh() {
+#ifndef USE_STUB_SDK
+    CGameEntitySystem* pEntitySystem = ReadEntitySystem();
+
+    // Never register twice with the same system. A replaced system took its
+    // listener list with it, so the old pointer is not touched.
+    if (s_pEntitySystem && s_pEntitySystem == pEntitySystem) {
+        s_pEntitySystem->RemoveListenerEntity(&s_entityListener);
+    }
+
+    s_pEntitySystem = pEntitySystem;
+    if (!s_pEntitySystem) return;
+
+    s_pEntitySystem->AddListenerEntity(&s_entityListener);
+    printf("[GoStrike] EntitySystem: acquired at %p, entity listener registered\n", s_pEntitySystem);
+#endif
+}
+
 void EntitySystem_Shutdown() {
 #ifndef USE_STUB_SDK
     if (s_pEntitySystem) {
@@ -104,6 +129,29 @@ const char* EntitySystem_GetEntityClassname(void* entity) {
 #endif
 }
 
+uint32_t EntitySystem_GetEntityHandle(void* entity) {
+#ifndef USE_STUB_SDK
+    if (!entity) return GS_INVALID_HANDLE;
+    auto* pEntity = static_cast<CEntityInstance*>(entity);
+    if (!pEntity->m_pEntity) return GS_INVALID_HANDLE;
+    return pEntity->m_pEntity->m_EHandle.ToInt();
+#else
+    (void)entity;
+    return GS_INVALID_HANDLE;
+#endif
+}
+
+void* EntitySystem_GetEntityByHandle(uint32_t handle) {
+#ifndef USE_STUB_SDK
+    if (!s_pEntitySystem || handle == GS_INVALID_HANDLE) return nullptr;
+    CEntityInstance* ent = s_pEntitySystem->GetEntityInstance(CEntityHandle(handle));
+    return static_cast<void*>(ent);
+#else
+    (void)handle;
+    return nullptr;
+#endif
+}
+
 void* EntitySystem_GetSystemPtr() {
 #ifndef USE_STUB_SDK
     return static_cast<void*>(s_pEntitySystem);
@@ -123,6 +171,60 @@ bool EntitySystem_IsEntityValid(void* entity) {
 #endif
 }
 
+// ============================================================
+// Bulk Classname Queries
+// ============================================================
+
+int32_t EntitySystem_FindByClassname(const char* classname, bool prefix,
+                                     gs_entity_ref_t* out, int32_t maxOut) {
+#ifndef USE_STUB_SDK
+    if (!s_pEntitySystem || !classname) return 0;
+
+    std::string pattern(classname);
+    if (!pattern.empty() && pattern.back() == '*') {
+        pattern.pop_back();
+        prefix = true;
+    }
+    if (pattern.empty() && !prefix) return 0;
+
+    // Designer names are CUtlSymbolLarge strings interned by the engine, so every
+    // entity of a class shares the same pointer. Memoize the match result per
+    // pointer: strcmp runs once per distinct class instead of once per entity.
+    static std::unordered_map<const char*, bool> s_matchMemo;
+    s_matchMemo.clear();
+
+    int32_t count = 0;
+    for (CEntityIdentity* pIdentity = s_pEntitySystem->m_EntityList.m_pFirstActiveEntity;
+         pIdentity; pIdentity = pIdentity->m_pNext) {
+        const char* name = pIdentity->m_designerName.String();
+        if (!name || !pIdentity->m_pInstance) continue;
+
+        bool match;
+        auto it = s_matchMemo.find(name);
+        if (it != s_matchMemo.end()) {
+            match = it->second;
+        } else {
+            match = prefix ? strncmp(name, pattern.c_str(), pattern.size()) == 0
+                           : strcmp(name, pattern.c_str()) == 0;
+            s_matchMemo.emplace(name, match);
+        }
+        if (!match) continue;
+
+        if (out && count < maxOut) {
+            out[count].index = pIdentity->m_EHandle.GetEntryIndex();
+            out[count].handle = pIdentity->m_EHandle.ToInt();
+            out[count].entity = static_cast<void*>(pIdentity->m_pInstance);
+            out[count].classname = name;
+        }
+        count++;
+    }
+    return count;
+#else
+    (void)classname; (void)prefix; (void)out; (void)maxOut;
+    return 0;
+#endif
+}
+
 } // namespace gostrike
 
 // ============================================================
@@ -147,6 +249,9 @@ void GoStrikeEntityListener::OnEntityCreated(CEntityInstance* pEntity) {
 void GoStrikeEntityListener::OnEntityDeleted(CEntityInstance* pEntity) {
     if (!pEntity || !pEntity->m_pEntity) return;
     uint32_t index = pEntity->m_pEntity->m_EHandle.GetEntryIndex();
+    gostrike::EntityHooks_OnEntityDeleted(pEntity->m_pEntity->m_EHandle.ToInt());
+    gostrike::TransmitManager_OnEntityDeleted(index);
+    gostrike::VisibilityManager_OnEntityDeleted(index);
     GoBridge_OnEntityDeleted(index);
 }
 
@@ -7,11 +7,18 @@
 
 #include <cstdint>
 
+#include "gostrike_abi.h"
+
 namespace gostrike {
 
 // Initialize entity system. Must be called after CGameResourceService is available.
 void EntitySystem_Initialize();
 
+// Re-read CGameEntitySystem and re-register the entity listener (map start).
+// The server recreates the entity system per map; without this, lookups and
+// delete notifications would stay bound to the one seen at plugin load.
+void EntitySystem_Refresh();
+
 // Shutdown entity system.
 void EntitySystem_Shutdown();
 
@@ -21,6 +28,19 @@ uint32_t EntitySystem_GetEntityIndex(void* entity);
 const char* EntitySystem_GetEntityClassname(void* entity);
 bool EntitySystem_IsEntityValid(void* entity);
 
+// Handle conversion. Handles carry a serial number, so a stale handle
+// resolves to nullptr instead of whatever entity reused the index.
+uint32_t EntitySystem_GetEntityHandle(void* entity);
+void* EntitySystem_GetEntityByHandle(uint32_t handle);
+
+// Walk the active entity list and collect every entity whose classname matches.
+// Classnames are compared by their interned designer-name pointer, so each distinct
+// class costs one string comparison per call regardless of how many entities it has.
+// A trailing '*' in classname (or prefix=true) selects prefix matching.
+// Returns the total match count; at most maxOut refs are written to out.
+int32_t EntitySystem_FindByClassname(const char* classname, bool prefix,
+                                     gs_entity_ref_t* out, int32_t maxOut);
+
 // Get the underlying CGameEntitySystem pointer (for GameEntitySystem() global)
 // Returns void* to avoid header dependency on entity2/entitysystem.h
 void* EntitySystem_GetSystemPtr();
@@ -0,0 +1,118 @@
+// field_path.cpp - Compiled field paths for nested component access
+//
+// Each "->" in a path becomes a hop: add the field offset, load the pointer
+// stored there. The last step is only an offset. A compiled path is therefore
+// a short offset array walked with a null check per hop, with no schema or
+// string work at read time.
+
+#include "field_path.h"
+#include "entity_system.h"
+#include "schema.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gostrike {
+
+struct CompiledPath {
+    std::vector<int32_t> hops;  // offsets of the pointer fields followed, in order
+    int32_t offset;             // offset of the final field in the last object
+};
+
+static std::vector<CompiledPath> s_paths;
+static std::unordered_map<std::string, int32_t> s_pathIds;
+
+// Resolve one "Class.field" step. Returns the offset, or 0 if unknown.
+static int32_t ResolveStep(const std::string& step) {
+    size_t dot = step.find('.');
+    if (dot == std::string::npos || dot == 0 || dot + 1 >= step.size()) return 0;
+    std::string className = step.substr(0, dot);
+    std::string fieldName = step.substr(dot + 1);
+    int32_t offset = schema::GetOffset(className.c_str(), fieldName.c_str()).offset;
+    return offset > 0 ? offset : 0;
+}
+
+int32_t FieldPath_Compile(const char* path) {
+    if (!path || !*path) return -1;
+
+    auto it = s_pathIds.find(path);
+    if (it != s_pathIds.end()) return it->second;
+
+    CompiledPath compiled;
+    std::string rest(path);
+    for (;;) {
+        size_t arrow = rest.find("->");
+        std::string step = rest.substr(0, arrow);
+        int32_t offset = ResolveStep(step);
+        if (offset == 0) {
+            printf("[GoStrike] FieldPath: cannot resolve '%s' in '%s'\n", step.c_str(), path);
+            s_pathIds.emplace(path, -1);  // schema does not change; fail fast next time
+            return -1;
+        }
+        if (arrow == std::string::npos) {
+            compiled.offset = offset;
+            break;
+        }
+        compiled.hops.push_back(offset);
+        rest.erase(0, arrow + 2);
+    }
+
+    int32_t id = static_cast<int32_t>(s_paths.size());
+    s_paths.push_back(std::move(compiled));
+    s_pathIds.emplace(path, id);
+    return id;
+}
+
+void* FieldPath_Resolve(int32_t id, void* entity) {
+    if (id < 0 || id >= static_cast<int32_t>(s_paths.size()) || !entity) return nullptr;
+
+    const CompiledPath& p = s_paths[id];
+    uint8_t* base = static_cast<uint8_t*>(entity);
+    for (int32_t hop : p.hops) {
+        base = *reinterpret_cast<uint8_t**>(base + hop);
+        if (!base) return nullptr;
+    }
+    return base + p.offset;
+}
+
+int32_t FieldPath_Read(int32_t id, const uint32_t* handles, int32_t count,
+                       int32_t size, uint8_t* out, bool* valid) {
+    if (!handles || !out || !valid || count <= 0) return 0;
+    if (size <= 0 || size > GS_PATH_MAX_VALUE) return 0;
+    if (id < 0 || id >= static_cast<int32_t>(s_paths.size())) return 0;
+
+    int32_t found = 0;
+    for (int32_t i = 0; i < count; i++) {
+        uint8_t* dst = out + static_cast<size_t>(i) * size;
+        void* field = FieldPath_Resolve(id, EntitySystem_GetEntityByHandle(handles[i]));
+        if (field) {
+            memcpy(dst, field, size);
+            valid[i] = true;
+            found++;
+        } else {
+            memset(dst, 0, size);
+            valid[i] = false;
+        }
+    }
+    return found;
+}
+
+void FieldPath_ClearFailures() {
+    for (auto it = s_pathIds.begin(); it != s_pathIds.end();) {
+        if (it->second < 0) {
+            it = s_pathIds.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void FieldPath_Shutdown() {
+    s_paths.clear();
+    s_pathIds.clear();
+}
+
+} // namespace gostrike
@@ -0,0 +1,34 @@
+// field_path.h - Compiled field paths for nested component access
+// A dotted path such as
+//   CBaseEntity.m_CBodyComponent->CBodyComponent.m_pSceneNode->CGameSceneNode.m_vecAbsOrigin
+// is resolved against the schema once and stored as a list of pointer-hop
+// offsets plus a final field offset. Reads then cost one load per hop.
+
+#ifndef GOSTRIKE_FIELD_PATH_H
+#define GOSTRIKE_FIELD_PATH_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Compile (or look up) a path. Returns its ID, or -1 on a syntax or schema
+// error (also remembered, so a bad path is reported once).
+int32_t FieldPath_Compile(const char* path);
+
+// Forget remembered failures so those paths are compiled again (map start)
+void FieldPath_ClearFailures();
+
+// Address of the path's final field on entity, or nullptr if a hop is null
+void* FieldPath_Resolve(int32_t id, void* entity);
+
+// Batch read, see gs_path_read_t. Returns the number of valid entries.
+int32_t FieldPath_Read(int32_t id, const uint32_t* handles, int32_t count,
+                       int32_t size, uint8_t* out, bool* valid);
+
+// Drop every compiled path
+void FieldPath_Shutdown();
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_FIELD_PATH_H
@@ -19,6 +19,8 @@
 #include "schema.h"
 #include "entity_system.h"
 #include "go_bridge.h"
+#include "weapon_registry.h"
+#include "item_rules.h"
 
 namespace gostrike {
 
@@ -39,6 +41,10 @@ static int s_offsetDamageType = 0x60;
 typedef void (*SwitchTeamFn)(void*, int);
 static SwitchTeamFn s_fnSwitchTeam = nullptr;
 
+// Address of the engine's CCSGameRules* global (gamedata "GameRules" with address steps).
+// The global is re-read on every access because gamerules are recreated each map.
+static void** s_ppGameRules = nullptr;
+
 void GameFunctions_Initialize() {
     // Cache gamedata offsets
     s_offsetRespawn = g_gameConfig.GetOffset("CCSPlayerController_Respawn");
@@ -63,13 +69,19 @@ void GameFunctions_Initialize() {
         s_fnSwitchTeam = reinterpret_cast<SwitchTeamFn>(switchTeamAddr);
     }
 
+    s_ppGameRules = static_cast<void**>(g_gameConfig.ResolveAddress("GameRules"));
+
     printf("[GoStrike] GameFunctions: initialized (respawn=%d, changeTeam=%d, teleport=%d, suicide=%d, removeWeapons=%d)\n",
            s_offsetRespawn, s_offsetChangeTeam, s_offsetTeleport, s_offsetCommitSuicide, s_offsetRemoveWeapons);
-    printf("[GoStrike] GameFunctions: SwitchTeam=%p\n", (void*)s_fnSwitchTeam);
+    printf("[GoStrike] GameFunctions: SwitchTeam=%p, GameRules global=%p\n", (void*)s_fnSwitchTeam, (void*)s_ppGameRules);
     printf("[GoStrike] GameFunctions: CTakeDamageInfo offsets (attacker=0x%X, damage=0x%X, damageType=0x%X)\n",
            s_offsetDamageAttacker, s_offsetDamage, s_offsetDamageType);
 }
 
+void* GameFunc_GetGameRules() {
+    return s_ppGameRules ? *s_ppGameRules : nullptr;
+}
+
 void GameFunc_Respawn(int32_t slot) {
 #ifndef USE_STUB_SDK
     if (s_offsetRespawn < 0) {
@@ -89,6 +101,17 @@ void GameFunc_Respawn(int32_t slot) {
 #endif
 }
 
+bool GameFunc_RespawnController(void* controller) {
+#ifndef USE_STUB_SDK
+    if (s_offsetRespawn < 0 || !controller) return false;
+    CallVirtual<void>(controller, s_offsetRespawn);
+    return true;
+#else
+    (void)controller;
+    return false;
+#endif
+}
+
 void GameFunc_ChangeTeam(int32_t slot, int32_t team) {
 #ifndef USE_STUB_SDK
     if (s_offsetChangeTeam < 0) {
@@ -106,6 +129,18 @@ void GameFunc_ChangeTeam(int32_t slot, int32_t team) {
 #endif
 }
 
+bool GameFunc_ChangeTeamController(void* controller, int32_t team) {
+#ifndef USE_STUB_SDK
+    if (s_offsetChangeTeam < 0 || !controller) return false;
+    CallVirtual<void>(controller, s_offsetChangeTeam, team);
+    return true;
+#else
+    (void)controller;
+    (void)team;
+    return false;
+#endif
+}
+
 void GameFunc_SwitchTeam(int32_t slot, int32_t team) {
 #ifndef USE_STUB_SDK
     if (!s_fnSwitchTeam) {
@@ -166,19 +201,38 @@ void GameFunc_Teleport(int32_t slot, gs_vector3_t* pos, gs_vector3_t* angles, gs
 #endif
 }
 
-void GameFunc_SetModel(void* entity, const char* model) {
+bool GameFunc_TeleportEntity(void* entity, const gs_vector3_t* pos, const gs_vector3_t* angles,
+                             const gs_vector3_t* velocity) {
 #ifndef USE_STUB_SDK
-    if (!entity || !model) return;
+    if (s_offsetTeleport < 0 || !entity) return false;
+    CallVirtual<void>(entity, s_offsetTeleport, pos, angles, velocity);
+    return true;
+#else
+    (void)entity;
+    (void)pos;
+    (void)angles;
+    (void)velocity;
+    return false;
+#endif
+}
+
+static void* s_fnSetModel = nullptr;
+static bool s_setModelResolved = false;
 
-    // Resolve SetModel signature if needed
-    static void* s_fnSetModel = nullptr;
-    static bool s_resolved = false;
-    if (!s_resolved) {
+static bool ResolveSetModel() {
+    // Lazy-resolve on first call (or at map start via GameFunctions_Warmup)
+    if (!s_setModelResolved) {
         s_fnSetModel = g_gameConfig.ResolveSignature("CBaseModelEntity_SetModel");
-        s_resolved = true;
+        s_setModelResolved = true;
     }
+    return s_fnSetModel != nullptr;
+}
 
-    if (!s_fnSetModel) {
+void GameFunc_SetModel(void* entity, const char* model) {
+#ifndef USE_STUB_SDK
+    if (!entity || !model) return;
+
+    if (!ResolveSetModel()) {
         printf("[GoStrike] GameFunc_SetModel: function not resolved\n");
         return;
     }
@@ -201,10 +255,7 @@ typedef void (*GiveNamedItemFn)(void* itemServices, const char* item, void* unk1
 static GiveNamedItemFn s_fnGiveNamedItem = nullptr;
 static bool s_giveNamedItemResolved = false;
 
-void GameFunc_GiveNamedItem(int32_t slot, const char* itemName) {
-#ifndef USE_STUB_SDK
-    if (!itemName) return;
-
+static bool ResolveGiveNamedItem() {
     // Lazy-resolve on first call
     if (!s_giveNamedItemResolved) {
         void* addr = g_gameConfig.ResolveSignature("GiveNamedItem");
@@ -214,8 +265,74 @@ void GameFunc_GiveNamedItem(int32_t slot, const char* itemName) {
         s_giveNamedItemResolved = true;
         printf("[GoStrike] GiveNamedItem resolved: %p\n", (void*)s_fnGiveNamedItem);
     }
+    return s_fnGiveNamedItem != nullptr;
+}
+
+void GameFunctions_Warmup() {
+    // Signature scans that would otherwise run on the first use in a round
+    ResolveGiveNamedItem();
+    ResolveSetModel();
+}
+
+void* GameFunc_GetItemServices(void* pawn) {
+#ifndef USE_STUB_SDK
+    if (!pawn) return nullptr;
+
+    // CCSPlayerPawnBase.m_pItemServices
+    auto itemServicesKey = schema::GetOffset("CCSPlayerPawnBase", "m_pItemServices");
+    if (itemServicesKey.offset <= 0) return nullptr;
+
+    return *reinterpret_cast<void**>(reinterpret_cast<uintptr_t>(pawn) + itemServicesKey.offset);
+#else
+    (void)pawn;
+    return nullptr;
+#endif
+}
+
+bool GameFunc_GiveNamedItemServices(void* itemServices, const char* itemName) {
+#ifndef USE_STUB_SDK
+    if (!itemServices || !itemName || !ResolveGiveNamedItem()) return false;
+
+    // Plugin-initiated gives are not subject to pickup/acquire restrictions
+    ItemRules_BeginBypass();
+
+    // Known items use the registry's static classname (no allocation)
+    if (const char* classname = WeaponRegistry_GetClassname(WeaponRegistry_Lookup(itemName))) {
+        s_fnGiveNamedItem(itemServices, classname, nullptr, nullptr, nullptr, nullptr);
+    } else if (strncmp(itemName, "weapon_", 7) == 0 || strncmp(itemName, "item_", 5) == 0) {
+        s_fnGiveNamedItem(itemServices, itemName, nullptr, nullptr, nullptr, nullptr);
+    } else {
+        // Prepend "weapon_" if not already present
+        std::string fullName = std::string("weapon_") + itemName;
+        s_fnGiveNamedItem(itemServices, fullName.c_str(), nullptr, nullptr, nullptr, nullptr);
+    }
+
+    ItemRules_EndBypass();
+    return true;
+#else
+    (void)itemServices;
+    (void)itemName;
+    (void)ResolveGiveNamedItem;
+    return false;
+#endif
+}
+
+bool GameFunc_RemoveWeaponsServices(void* itemServices) {
+#ifndef USE_STUB_SDK
+    if (s_offsetRemoveWeapons < 0 || !itemServices) return false;
+    CallVirtual<void>(itemServices, s_offsetRemoveWeapons);
+    return true;
+#else
+    (void)itemServices;
+    return false;
+#endif
+}
+
+void GameFunc_GiveNamedItem(int32_t slot, const char* itemName) {
+#ifndef USE_STUB_SDK
+    if (!itemName) return;
 
-    if (!s_fnGiveNamedItem) {
+    if (!ResolveGiveNamedItem()) {
         printf("[GoStrike] GameFunc_GiveNamedItem: function not resolved\n");
         return;
     }
@@ -226,26 +343,13 @@ void GameFunc_GiveNamedItem(int32_t slot, const char* itemName) {
         return;
     }
 
-    // Get CCSPlayer_ItemServices from pawn via schema: CCSPlayerPawnBase.m_pItemServices
-    auto itemServicesKey = schema::GetOffset("CCSPlayerPawnBase", "m_pItemServices");
-    if (itemServicesKey.offset <= 0) {
-        printf("[GoStrike] GameFunc_GiveNamedItem: m_pItemServices offset not found\n");
-        return;
-    }
-
-    void* itemServices = *reinterpret_cast<void**>(reinterpret_cast<uintptr_t>(pawn) + itemServicesKey.offset);
+    void* itemServices = GameFunc_GetItemServices(pawn);
     if (!itemServices) {
         printf("[GoStrike] GameFunc_GiveNamedItem: itemServices is null for slot %d\n", slot);
         return;
     }
 
-    // Prepend "weapon_" if not already present
-    std::string fullName(itemName);
-    if (fullName.find("weapon_") != 0 && fullName.find("item_") != 0) {
-        fullName = "weapon_" + fullName;
-    }
-
-    s_fnGiveNamedItem(itemServices, fullName.c_str(), nullptr, nullptr, nullptr, nullptr);
+    GameFunc_GiveNamedItemServices(itemServices, itemName);
 #else
     (void)slot;
     (void)itemName;
@@ -265,20 +369,13 @@ void GameFunc_DropWeapons(int32_t slot) {
         return;
     }
 
-    // Get CCSPlayer_ItemServices from pawn via schema (same as GiveNamedItem)
-    auto itemServicesKey = schema::GetOffset("CCSPlayerPawnBase", "m_pItemServices");
-    if (itemServicesKey.offset <= 0) {
-        printf("[GoStrike] GameFunc_DropWeapons: m_pItemServices offset not found\n");
-        return;
-    }
-
-    void* itemServices = *reinterpret_cast<void**>(reinterpret_cast<uintptr_t>(pawn) + itemServicesKey.offset);
+    void* itemServices = GameFunc_GetItemServices(pawn);
     if (!itemServices) {
         printf("[GoStrike] GameFunc_DropWeapons: itemServices is null for slot %d\n", slot);
         return;
     }
 
-    CallVirtual<void>(itemServices, s_offsetRemoveWeapons);
+    GameFunc_RemoveWeaponsServices(itemServices);
 #else
     (void)slot;
 #endif
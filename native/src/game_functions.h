@@ -12,6 +12,9 @@ namespace gostrike {
 // Initialize game function pointers from gamedata
 void GameFunctions_Initialize();
 
+// Resolve the lazily-resolved functions (GiveNamedItem, SetModel) up front
+void GameFunctions_Warmup();
+
 // Player actions
 void GameFunc_Respawn(int32_t slot);
 void GameFunc_ChangeTeam(int32_t slot, int32_t team);
@@ -19,6 +22,9 @@ void GameFunc_SwitchTeam(int32_t slot, int32_t team);
 void GameFunc_Slay(int32_t slot);
 void GameFunc_Teleport(int32_t slot, gs_vector3_t* pos, gs_vector3_t* angles, gs_vector3_t* velocity);
 
+// Current CCSGameRules* (nullptr between maps or without a "GameRules" gamedata entry)
+void* GameFunc_GetGameRules();
+
 // Entity actions
 void GameFunc_SetModel(void* entity, const char* model);
 
@@ -26,6 +32,16 @@ void GameFunc_SetModel(void* entity, const char* model);
 void GameFunc_GiveNamedItem(int32_t slot, const char* itemName);
 void GameFunc_DropWeapons(int32_t slot);
 
+// Entity-level variants for callers that already resolved the controller/pawn
+// (batched player ops). Return false when the entity or gamedata is missing.
+bool GameFunc_RespawnController(void* controller);
+bool GameFunc_ChangeTeamController(void* controller, int32_t team);
+bool GameFunc_TeleportEntity(void* entity, const gs_vector3_t* pos, const gs_vector3_t* angles,
+                             const gs_vector3_t* velocity);
+void* GameFunc_GetItemServices(void* pawn);
+bool GameFunc_GiveNamedItemServices(void* itemServices, const char* itemName);
+bool GameFunc_RemoveWeaponsServices(void* itemServices);
+
 // Damage hook (funchook on CBaseEntity_TakeDamageOld)
 void GameFunc_InitDamageHook();
 void GameFunc_ShutdownDamageHook();
@@ -6,6 +6,7 @@
 #include "memory_module.h"
 
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <nlohmann/json.hpp>
 
@@ -49,6 +50,14 @@ bool GameConfig::Init(const char* path, char* error, int errorSize) {
             if (sig.contains("library")) {
                 m_libraries[key] = sig["library"].get<std::string>();
             }
+            // Optional ELF symbol (mangled name), preferred over the scan when present
+            if (sig.contains("symbol") && sig["symbol"].is_string()) {
+                m_symbols[key] = sig["symbol"].get<std::string>();
+            }
+            // Entries known to have no verified signature say why
+            if (sig.contains("unsupported") && sig["unsupported"].is_string()) {
+                m_unsupported[key] = sig["unsupported"].get<std::string>();
+            }
             // Use linux signatures (we only target Linux)
             if (sig.contains("linux")) {
                 std::string sigStr = sig["linux"].get<std::string>();
@@ -57,6 +66,28 @@ bool GameConfig::Init(const char* path, char* error, int errorSize) {
             }
         }
 
+        // Parse signature post-processing steps
+        if (value.contains("address") && value["address"].is_array()) {
+            std::vector<AddressStep> steps;
+            for (auto& s : value["address"]) {
+                AddressStep step = {AddressStep::Offset, 0, 0, s.value("repeat", 1)};
+                if (s.contains("offset")) {
+                    step.value = s["offset"].get<int>();
+                } else if (s.contains("rip")) {
+                    step.kind = AddressStep::Rip;
+                    step.value = s["rip"].get<int>();
+                    step.length = s.value("length", step.value + 4);
+                } else if (s.contains("read")) {
+                    step.kind = AddressStep::Read;
+                } else {
+                    printf("[GoStrike] GameData: '%s' has an unknown address step\n", key.c_str());
+                    continue;
+                }
+                steps.push_back(step);
+            }
+            m_addressSteps[key] = std::move(steps);
+        }
+
         // Parse offsets
         if (value.contains("offsets")) {
             auto& off = value["offsets"];
@@ -64,6 +95,12 @@ bool GameConfig::Init(const char* path, char* error, int errorSize) {
                 m_offsets[key] = off["linux"].get<int>();
                 offsetCount++;
             }
+            if (off.contains("class") && off["class"].is_string()) {
+                m_vtableClasses[key] = off["class"].get<std::string>();
+            }
+            if (off.contains("prologue") && off["prologue"].is_string()) {
+                m_prologues[key] = off["prologue"].get<std::string>();
+            }
         }
     }
 
@@ -89,6 +126,16 @@ int GameConfig::GetOffset(const std::string& name) const {
     return it->second;
 }
 
+void GameConfig::SetOffset(const std::string& name, int offset) {
+    m_offsets[name] = offset;
+}
+
+const char* GameConfig::GetPrologue(const std::string& name) const {
+    auto it = m_prologues.find(name);
+    if (it == m_prologues.end()) return nullptr;
+    return it->second.c_str();
+}
+
 bool GameConfig::IsSymbol(const char* sig) {
     return sig && sig[0] == '@';
 }
@@ -118,10 +165,26 @@ void* GameConfig::ResolveSignature(const std::string& name) {
         return nullptr;
     }
 
+    // A symbol lookup is a hash probe; only scan when the module lacks it
+    auto symbol = m_symbols.find(name);
+    if (symbol != m_symbols.end()) {
+        void* addr = module->FindSymbol(symbol->second.c_str());
+        if (addr) {
+            m_addressCache[name] = addr;
+            printf("[GoStrike] GameData: resolved '%s' -> %p (symbol)\n", name.c_str(), addr);
+            return addr;
+        }
+    }
+
     // Get the signature/symbol string
     const char* sig = GetSignature(name);
     if (!sig) {
-        printf("[GoStrike] GameData: no signature for '%s'\n", name.c_str());
+        auto unsupported = m_unsupported.find(name);
+        if (unsupported != m_unsupported.end()) {
+            printf("[GoStrike] GameData: '%s' is unsupported: %s\n", name.c_str(), unsupported->second.c_str());
+        } else {
+            printf("[GoStrike] GameData: no signature for '%s'\n", name.c_str());
+        }
         return nullptr;
     }
 
@@ -151,4 +214,32 @@ void* GameConfig::ResolveSignature(const std::string& name) {
     return addr;
 }
 
+void* GameConfig::ResolveAddress(const std::string& name) {
+    auto* addr = static_cast<uint8_t*>(ResolveSignature(name));
+
+    auto it = m_addressSteps.find(name);
+    if (!addr || it == m_addressSteps.end()) return addr;
+
+    for (const auto& step : it->second) {
+        for (int r = 0; r < step.repeat && addr; r++) {
+            switch (step.kind) {
+            case AddressStep::Offset:
+                addr += step.value;
+                break;
+            case AddressStep::Rip: {
+                int32_t disp;
+                memcpy(&disp, addr + step.value, sizeof(disp));
+                addr += step.length + disp;
+                break;
+            }
+            case AddressStep::Read:
+                addr = *reinterpret_cast<uint8_t**>(addr);
+                break;
+            }
+        }
+        if (!addr) return nullptr;
+    }
+    return addr;
+}
+
 } // namespace gostrike
@@ -9,11 +9,26 @@
 #include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace gostrike {
 
 class Module; // forward declare
 
+// One post-processing step applied to a resolved signature ("address" array).
+//   {"offset": n}                  address += n
+//   {"rip": n, "length": m}        address = address + m + int32 at (address + n);
+//                                  m defaults to n + 4 (operand ends the instruction)
+//   {"read": true}                 address = *(void**)address
+// Any step may carry "repeat": k to apply it k times.
+struct AddressStep {
+    enum Kind { Offset, Rip, Read };
+    Kind kind;
+    int value;
+    int length;
+    int repeat;
+};
+
 class GameConfig {
 public:
     GameConfig() = default;
@@ -31,11 +46,25 @@ public:
     // Get the offset for a gamedata entry. Returns -1 if not found.
     int GetOffset(const std::string& name) const;
 
+    // Override an offset (e.g. a vtable index corrected by the vtable analyzer)
+    void SetOffset(const std::string& name, int offset);
+
+    // Vtable offsets: the owning class ("class") and an optional function prologue
+    // signature ("prologue") used to validate or rediscover the index
+    const char* GetPrologue(const std::string& name) const;
+    const std::unordered_map<std::string, std::string>& GetVTableClasses() const { return m_vtableClasses; }
+
     // Resolve a gamedata entry to a memory address.
-    // Uses the signature to scan the appropriate module.
+    // Uses the entry's ELF symbol when the module has it, otherwise the
+    // signature to scan the appropriate module.
     // Returns nullptr if not found.
     void* ResolveSignature(const std::string& name);
 
+    // Resolve a gamedata entry and apply its "address" steps. Entries without
+    // steps resolve like ResolveSignature. Reads are performed on every call,
+    // so an entry ending in a global's address stays valid across maps.
+    void* ResolveAddress(const std::string& name);
+
     // Get the module for a gamedata entry's library
     Module* GetModule(const std::string& name) const;
 
@@ -46,8 +75,13 @@ private:
     std::string m_path;
     std::unordered_map<std::string, std::string> m_signatures; // name -> signature
     std::unordered_map<std::string, std::string> m_libraries;  // name -> library
+    std::unordered_map<std::string, std::string> m_symbols;    // name -> ELF symbol tried before the scan
+    std::unordered_map<std::string, std::string> m_unsupported; // name -> reason no signature is shipped
     std::unordered_map<std::string, int> m_offsets;            // name -> offset
+    std::unordered_map<std::string, std::string> m_vtableClasses; // name -> vtable class
+    std::unordered_map<std::string, std::string> m_prologues;  // name -> function prologue
     std::unordered_map<std::string, void*> m_addressCache;     // name -> resolved addr
+    std::unordered_map<std::string, std::vector<AddressStep>> m_addressSteps; // name -> post-processing
 };
 
 // Global game config instance
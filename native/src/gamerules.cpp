@@ -0,0 +1,169 @@
+// gamerules.cpp - Cached CCSGameRules access and round-state snapshot
+//
+// The proxy and team entities are tracked by handle, so revalidating them each
+// frame is a handle lookup. When they are gone (map change) the entity list is
+// searched again, at most once per kRescanInterval frames.
+
+#include "gamerules.h"
+#include "entity_system.h"
+#include "game_functions.h"
+#include "gameconfig.h"
+#include "schema.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace gostrike {
+
+static constexpr int kRescanInterval = 64;
+static constexpr int kMaxTeams = 4;
+
+static gs_gamerules_t s_state = {};
+
+#ifndef USE_STUB_SDK
+// void CCSGameRules::TerminateRound(float delay, RoundEndReason reason, int64, uint32)
+typedef void (*TerminateRoundFn)(void* gameRules, float delay, int32_t reason, int64_t unk1, uint32_t unk2);
+static TerminateRoundFn s_fnTerminateRound = nullptr;
+
+static uint32_t s_proxyHandle = GS_INVALID_HANDLE;
+static uint32_t s_teamHandles[kMaxTeams];
+static int s_rescanCountdown = 0;
+
+// Schema offsets (0 = unresolved)
+static int32_t s_offProxyGameRules = 0;
+static int32_t s_offWarmup = 0;
+static int32_t s_offFreeze = 0;
+static int32_t s_offBombPlanted = 0;
+static int32_t s_offGamePhase = 0;
+static int32_t s_offRoundsPlayed = 0;
+static int32_t s_offRoundTime = 0;
+static int32_t s_offRoundStart = 0;
+static int32_t s_offWarmupEnd = 0;
+static int32_t s_offWinReason = 0;
+static int32_t s_offTeamNum = 0;
+static int32_t s_offTeamScore = 0;
+
+template <typename T>
+static T ReadField(void* base, int32_t offset) {
+    if (!base || offset <= 0) return T();
+    T value;
+    memcpy(&value, static_cast<uint8_t*>(base) + offset, sizeof(T));
+    return value;
+}
+
+// Find the cs_gamerules proxy and the team entities
+static void FindEntities() {
+    gs_entity_ref_t ref;
+    s_proxyHandle = EntitySystem_FindByClassname("cs_gamerules", false, &ref, 1) > 0
+                        ? ref.handle : GS_INVALID_HANDLE;
+
+    for (int t = 0; t < kMaxTeams; t++) s_teamHandles[t] = GS_INVALID_HANDLE;
+    gs_entity_ref_t teams[8];
+    int32_t n = EntitySystem_FindByClassname("cs_team_manager", false, teams, 8);
+    for (int32_t i = 0; i < n && i < 8; i++) {
+        int32_t team = ReadField<int32_t>(teams[i].entity, s_offTeamNum);
+        if (team >= 0 && team < kMaxTeams) s_teamHandles[team] = teams[i].handle;
+    }
+}
+
+static void* ResolveGameRules() {
+    // The gamedata global is authoritative when present
+    void* rules = GameFunc_GetGameRules();
+    if (rules) return rules;
+
+    void* proxy = EntitySystem_GetEntityByHandle(s_proxyHandle);
+    if (!proxy) return nullptr;
+    return ReadField<void*>(proxy, s_offProxyGameRules);
+}
+#endif
+
+void GameRules_Initialize() {
+#ifndef USE_STUB_SDK
+    s_fnTerminateRound = reinterpret_cast<TerminateRoundFn>(
+        g_gameConfig.ResolveSignature("CCSGameRules_TerminateRound"));
+
+    s_offProxyGameRules = schema::GetOffset("CCSGameRulesProxy", "m_pGameRules").offset;
+    s_offWarmup = schema::GetOffset("CCSGameRules", "m_bWarmupPeriod").offset;
+    s_offFreeze = schema::GetOffset("CCSGameRules", "m_bFreezePeriod").offset;
+    s_offBombPlanted = schema::GetOffset("CCSGameRules", "m_bBombPlanted").offset;
+    s_offGamePhase = schema::GetOffset("CCSGameRules", "m_gamePhase").offset;
+    s_offRoundsPlayed = schema::GetOffset("CCSGameRules", "m_totalRoundsPlayed").offset;
+    s_offRoundTime = schema::GetOffset("CCSGameRules", "m_iRoundTime").offset;
+    s_offRoundStart = schema::GetOffset("CCSGameRules", "m_fRoundStartTime").offset;
+    s_offWarmupEnd = schema::GetOffset("CCSGameRules", "m_fWarmupPeriodEnd").offset;
+    s_offWinReason = schema::GetOffset("CCSGameRules", "m_eRoundWinReason").offset;
+    s_offTeamNum = schema::GetOffset("CBaseEntity", "m_iTeamNum").offset;
+    s_offTeamScore = schema::GetOffset("CTeam", "m_iScore").offset;
+
+    s_proxyHandle = GS_INVALID_HANDLE;
+    for (int t = 0; t < kMaxTeams; t++) s_teamHandles[t] = GS_INVALID_HANDLE;
+    s_rescanCountdown = 0;
+
+    printf("[GoStrike] GameRules: initialized (TerminateRound=%p, proxy m_pGameRules=0x%X)\n",
+           (void*)s_fnTerminateRound, s_offProxyGameRules);
+#endif
+}
+
+void GameRules_OnGameFrame() {
+#ifndef USE_STUB_SDK
+    if (!EntitySystem_GetSystemPtr()) return;
+
+    bool stale = !EntitySystem_GetEntityByHandle(s_proxyHandle) ||
+                 !EntitySystem_GetEntityByHandle(s_teamHandles[2]) ||
+                 !EntitySystem_GetEntityByHandle(s_teamHandles[3]);
+    if (stale && --s_rescanCountdown <= 0) {
+        FindEntities();
+        s_rescanCountdown = kRescanInterval;
+    }
+
+    void* rules = ResolveGameRules();
+    s_state.gamerules = rules;
+    s_state.warmup = ReadField<bool>(rules, s_offWarmup);
+    s_state.freeze_period = ReadField<bool>(rules, s_offFreeze);
+    s_state.bomb_planted = ReadField<bool>(rules, s_offBombPlanted);
+    s_state.game_phase = ReadField<int32_t>(rules, s_offGamePhase);
+    s_state.rounds_played = ReadField<int32_t>(rules, s_offRoundsPlayed);
+    s_state.round_time = ReadField<int32_t>(rules, s_offRoundTime);
+    s_state.round_start_time = ReadField<float>(rules, s_offRoundStart);
+    s_state.warmup_end = ReadField<float>(rules, s_offWarmupEnd);
+    s_state.win_reason = ReadField<int32_t>(rules, s_offWinReason);
+    s_state.score_t = ReadField<int32_t>(EntitySystem_GetEntityByHandle(s_teamHandles[2]), s_offTeamScore);
+    s_state.score_ct = ReadField<int32_t>(EntitySystem_GetEntityByHandle(s_teamHandles[3]), s_offTeamScore);
+#endif
+}
+
+void GameRules_Reset() {
+    s_state = {};
+#ifndef USE_STUB_SDK
+    s_proxyHandle = GS_INVALID_HANDLE;
+    for (int t = 0; t < kMaxTeams; t++) s_teamHandles[t] = GS_INVALID_HANDLE;
+    s_rescanCountdown = 0;
+#endif
+}
+
+void* GameRules_Get() {
+#ifndef USE_STUB_SDK
+    return ResolveGameRules();
+#else
+    return nullptr;
+#endif
+}
+
+const gs_gamerules_t* GameRules_GetState() {
+    return &s_state;
+}
+
+bool GameRules_TerminateRound(float delay, int32_t reason) {
+#ifndef USE_STUB_SDK
+    void* rules = ResolveGameRules();
+    if (!rules || !s_fnTerminateRound) return false;
+    s_fnTerminateRound(rules, delay, reason, 0, 0);
+    return true;
+#else
+    (void)delay;
+    (void)reason;
+    return false;
+#endif
+}
+
+} // namespace gostrike
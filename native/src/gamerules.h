@@ -0,0 +1,35 @@
+// gamerules.h - Cached CCSGameRules access and round-state snapshot
+// The gamerules pointer comes from the gamedata "GameRules" global when present,
+// otherwise from the cs_gamerules proxy entity. Round state is read once per
+// frame into a gs_gamerules_t so Go reads cost no schema lookups.
+
+#ifndef GOSTRIKE_GAMERULES_H
+#define GOSTRIKE_GAMERULES_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Resolve TerminateRound and the schema offsets (after schema init)
+void GameRules_Initialize();
+
+// Revalidate the cached pointers and refresh the snapshot (game thread, once per frame)
+void GameRules_OnGameFrame();
+
+// Forget the cached entity handles and snapshot (map end). The next frame
+// searches for the new map's proxy and team entities immediately.
+void GameRules_Reset();
+
+// Current CCSGameRules*, or nullptr between maps
+void* GameRules_Get();
+
+// Snapshot from the last game frame (never null; gamerules is NULL when invalid)
+const gs_gamerules_t* GameRules_GetState();
+
+// End the current round. reason: gs_round_end_reason_t
+bool GameRules_TerminateRound(float delay, int32_t reason);
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_GAMERULES_H
@@ -10,6 +10,24 @@
 #include "player_manager.h"
 #include "game_functions.h"
 #include "chat_manager.h"
+#include "spawn_manager.h"
+#include "entity_io.h"
+#include "entity_hooks.h"
+#include "transmit_manager.h"
+#include "visibility_manager.h"
+#include "trace_manager.h"
+#include "player_ops.h"
+#include "weapon_registry.h"
+#include "item_rules.h"
+#include "hook_manager.h"
+#include "native_calls.h"
+#include "gamerules.h"
+#include "input_capture.h"
+#include "player_history.h"
+#include "property_watch.h"
+#include "field_path.h"
+#include "entity_arrays.h"
+#include "string_table.h"
 #include <dlfcn.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -47,8 +65,8 @@ static int32_t (*pfn_GoStrike_GetABIVersion)(void) = nullptr;
 static void (*pfn_GoStrike_RegisterCallbacks)(gs_callbacks_t*) = nullptr;
 
 // V2: Entity lifecycle
-static void (*pfn_GoStrike_OnEntityCreated)(uint32_t, const char*) = nullptr;
-static void (*pfn_GoStrike_OnEntitySpawned)(uint32_t, const char*) = nullptr;
+static void (*pfn_GoStrike_OnEntityCreated)(uint32_t, uint32_t) = nullptr;
+static void (*pfn_GoStrike_OnEntitySpawned)(uint32_t, uint32_t) = nullptr;
 static void (*pfn_GoStrike_OnEntityDeleted)(uint32_t) = nullptr;
 
 // ============================================================
@@ -121,6 +139,9 @@ static gs_player_t* CB_GetPlayer(int32_t slot) {
 }
 
 #ifndef USE_STUB_SDK
+// Pawn origin path, compiled by GoBridge_Warmup (load and every map start)
+static int32_t s_originPath = -1;
+
 // Refresh live player data from schema/entity system (game thread only)
 static void RefreshPlayerCache() {
     // Don't access entity system until it's initialized
@@ -158,24 +179,10 @@ static void RefreshPlayerCache() {
                 g_playerCache[i].armor = *reinterpret_cast<int32_t*>(reinterpret_cast<uintptr_t>(pawn) + armorKey.offset);
             }
             // Position from CGameSceneNode (CBodyComponent -> m_pSceneNode -> m_vecAbsOrigin)
-            auto bodyKey = gostrike::schema::GetOffset("CBaseEntity", "m_CBodyComponent");
-            if (bodyKey.offset > 0) {
-                void* bodyComp = *reinterpret_cast<void**>(reinterpret_cast<uintptr_t>(pawn) + bodyKey.offset);
-                if (bodyComp) {
-                    auto sceneNodeKey = gostrike::schema::GetOffset("CBodyComponent", "m_pSceneNode");
-                    if (sceneNodeKey.offset > 0) {
-                        void* sceneNode = *reinterpret_cast<void**>(reinterpret_cast<uintptr_t>(bodyComp) + sceneNodeKey.offset);
-                        if (sceneNode) {
-                            auto posKey = gostrike::schema::GetOffset("CGameSceneNode", "m_vecAbsOrigin");
-                            if (posKey.offset > 0) {
-                                float* pos = reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(sceneNode) + posKey.offset);
-                                g_playerCache[i].position.x = pos[0];
-                                g_playerCache[i].position.y = pos[1];
-                                g_playerCache[i].position.z = pos[2];
-                            }
-                        }
-                    }
-                }
+            if (auto* pos = static_cast<const float*>(gostrike::FieldPath_Resolve(s_originPath, pawn))) {
+                g_playerCache[i].position.x = pos[0];
+                g_playerCache[i].position.y = pos[1];
+                g_playerCache[i].position.z = pos[2];
             }
         }
     }
@@ -297,7 +304,8 @@ static int32_t CB_SchemaGetOffset(const char* className, const char* fieldName,
 // Schema: set state changed
 static void CB_SchemaSetStateChanged(void* entity, const char* className, const char* fieldName, int32_t offset) {
 #ifndef USE_STUB_SDK
-    gostrike::schema::SetStateChanged(entity, className, fieldName, offset);
+    (void)className; (void)fieldName;
+    gostrike::schema::QueueStateChanged(entity, offset);
 #else
     (void)entity; (void)className; (void)fieldName; (void)offset;
 #endif
@@ -323,7 +331,7 @@ static void CB_EntitySetInt(void* entity, const char* className, const char* fie
     if (key.offset == 0) return;
     *reinterpret_cast<int32_t*>(reinterpret_cast<uintptr_t>(entity) + key.offset) = value;
     if (key.networked) {
-        gostrike::schema::SetStateChanged(entity, className, fieldName, key.offset);
+        gostrike::schema::QueueStateChanged(entity, key.offset);
     }
 #else
     (void)entity; (void)className; (void)fieldName; (void)value;
@@ -349,7 +357,7 @@ static void CB_EntitySetFloat(void* entity, const char* className, const char* f
     if (key.offset == 0) return;
     *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(entity) + key.offset) = value;
     if (key.networked) {
-        gostrike::schema::SetStateChanged(entity, className, fieldName, key.offset);
+        gostrike::schema::QueueStateChanged(entity, key.offset);
     }
 #else
     (void)entity; (void)className; (void)fieldName; (void)value;
@@ -375,7 +383,7 @@ static void CB_EntitySetBool(void* entity, const char* className, const char* fi
     if (key.offset == 0) return;
     *reinterpret_cast<bool*>(reinterpret_cast<uintptr_t>(entity) + key.offset) = value;
     if (key.networked) {
-        gostrike::schema::SetStateChanged(entity, className, fieldName, key.offset);
+        gostrike::schema::QueueStateChanged(entity, key.offset);
     }
 #else
     (void)entity; (void)className; (void)fieldName; (void)value;
@@ -424,7 +432,7 @@ static void CB_EntitySetVector(void* entity, const char* className, const char*
     vec[1] = value->y;
     vec[2] = value->z;
     if (key.networked) {
-        gostrike::schema::SetStateChanged(entity, className, fieldName, key.offset);
+        gostrike::schema::QueueStateChanged(entity, key.offset);
     }
 #else
     (void)entity; (void)className; (void)fieldName; (void)value;
@@ -451,7 +459,7 @@ static bool CB_IsEntityValid(void* entity) {
 // GameData callbacks
 static void* CB_ResolveGamedata(const char* name) {
     if (!name) return nullptr;
-    return gostrike::g_gameConfig.ResolveSignature(name);
+    return gostrike::g_gameConfig.ResolveAddress(name);
 }
 
 static int32_t CB_GetGamedataOffset(const char* name) {
@@ -614,6 +622,218 @@ static void CB_PlayerDropWeapons(int32_t slot) {
     gostrike::GameFunc_DropWeapons(slot);
 }
 
+// ============================================================
+// V6 Callbacks: Entity Queries
+// ============================================================
+
+static int32_t CB_FindEntitiesByClassname(const char* classname, bool prefix,
+                                          gs_entity_ref_t* out, int32_t maxOut) {
+    return gostrike::EntitySystem_FindByClassname(classname, prefix, out, maxOut);
+}
+
+static uint32_t CB_GetEntityHandle(void* entity) {
+    return gostrike::EntitySystem_GetEntityHandle(entity);
+}
+
+// ============================================================
+// V6 Callbacks: Entity Spawning
+// ============================================================
+
+static int32_t CB_SpawnEntities(const gs_spawn_spec_t* specs, int32_t count, gs_entity_ref_t* out) {
+    return gostrike::SpawnManager_SpawnEntities(specs, count, out);
+}
+
+static int32_t CB_RemoveEntities(const uint32_t* handles, int32_t count) {
+    return gostrike::SpawnManager_RemoveEntities(handles, count);
+}
+
+static int32_t CB_FireInputs(const gs_input_req_t* reqs, int32_t count) {
+    return gostrike::EntityIO_FireInputs(reqs, count);
+}
+
+static void CB_SubscribeEntityOutput(uint32_t handle, const char* output, bool enable) {
+    gostrike::EntityHooks_SubscribeOutput(handle, output, enable);
+}
+
+static void CB_SubscribeTriggerTouch(uint32_t handle, bool enable) {
+    gostrike::EntityHooks_SubscribeTouch(handle, enable);
+}
+
+static void CB_TransmitSetHidden(int32_t slot, const uint32_t* indices, int32_t count, bool hidden) {
+    gostrike::TransmitManager_SetHidden(slot, indices, count, hidden);
+}
+
+static void CB_TransmitClear(int32_t slot) {
+    gostrike::TransmitManager_ClearSlot(slot);
+}
+
+static void CB_VisibilityConfigure(const gs_visibility_config_t* config) {
+    gostrike::VisibilityManager_Configure(config);
+}
+
+static int32_t CB_VisibilityGetMatrix(uint64_t* outRows) {
+    return gostrike::VisibilityManager_GetMatrix(outRows);
+}
+
+static int32_t CB_TraceBatch(const gs_ray_t* rays, int32_t n, uint64_t mask, uint32_t flags,
+                             gs_trace_result_t* out) {
+    return gostrike::TraceManager_TraceBatch(rays, n, mask, flags, out);
+}
+
+static bool CB_TraceAvailable() {
+    return gostrike::TraceManager_IsAvailable();
+}
+
+// ============================================================
+// V6 Callbacks: Batched Player Operations
+// ============================================================
+
+static int32_t CB_PlayerOpsSubmit(const gs_player_op_t* ops, int32_t n) {
+    return gostrike::PlayerOps_Submit(ops, n);
+}
+
+// ============================================================
+// V6 Callbacks: Weapon Registry
+// ============================================================
+
+static int32_t CB_WeaponList(gs_weapon_info_t* out, int32_t max) {
+    return gostrike::WeaponRegistry_List(out, max);
+}
+
+static int32_t CB_GiveItems(int32_t slot, const int32_t* itemIds, int32_t n) {
+    return gostrike::WeaponRegistry_GiveItems(slot, itemIds, n);
+}
+
+// ============================================================
+// V6 Callbacks: Item Restrictions
+// ============================================================
+
+static void CB_ItemRulesSet(int32_t rule, int32_t target, const int32_t* itemIds, int32_t n, bool enable) {
+    gostrike::ItemRules_Set(rule, target, itemIds, n, enable);
+}
+
+static void CB_ItemSetLimit(int32_t team, int32_t itemId, int32_t limit) {
+    gostrike::ItemRules_SetLimit(team, itemId, limit);
+}
+
+static void CB_ItemSetCount(int32_t team, int32_t itemId, int32_t count) {
+    gostrike::ItemRules_SetCount(team, itemId, count);
+}
+
+static void CB_ItemRulesClear() {
+    gostrike::ItemRules_Clear();
+}
+
+// ============================================================
+// V6 Callbacks: Generic Function Hooks
+// ============================================================
+
+static int32_t CB_HookDefine(const char* name, int32_t retType, const int32_t* argTypes, int32_t argc) {
+    return gostrike::HookManager_Define(name, retType, argTypes, argc);
+}
+
+static void CB_HookSubscribe(int32_t hookId, bool post, bool enable) {
+    gostrike::HookManager_SubscribeGo(hookId, post, enable);
+}
+
+// ============================================================
+// V6 Callbacks: Native Calls
+// ============================================================
+
+static int32_t CB_CallDefine(const char* name, int32_t vtableIndex, int32_t retType,
+                             const int32_t* argTypes, int32_t argc) {
+    return gostrike::NativeCalls_Define(name, vtableIndex, retType, argTypes, argc);
+}
+
+static bool CB_CallInvoke(int32_t callId, const uint64_t* args, const gs_vector3_t* vectors, uint64_t* ret) {
+    return gostrike::NativeCalls_Invoke(callId, args, vectors, ret);
+}
+
+// ============================================================
+// V6 Callbacks: Gamerules
+// ============================================================
+
+static const gs_gamerules_t* CB_GetGameRules() {
+    return gostrike::GameRules_GetState();
+}
+
+static bool CB_TerminateRound(float delay, int32_t reason) {
+    return gostrike::GameRules_TerminateRound(delay, reason);
+}
+
+// ============================================================
+// V6 Callbacks: Player Input
+// ============================================================
+
+static void CB_InputCapture(bool enable) {
+    gostrike::InputCapture_Enable(enable);
+}
+
+// ============================================================
+// V6 Callbacks: Player History
+// ============================================================
+
+static int32_t CB_HistoryQuery(const int32_t* slots, int32_t count, float tick, gs_player_sample_t* out) {
+    return gostrike::PlayerHistory_Query(slots, count, tick, out);
+}
+
+static int32_t CB_HistoryLatestTick() {
+    return gostrike::PlayerHistory_LatestTick();
+}
+
+// ============================================================
+// V6 Callbacks: Property Watchers
+// ============================================================
+
+static int32_t CB_WatchAdd(uint32_t entityHandle, const char* className, const char* fieldName, int32_t size) {
+    return gostrike::PropertyWatch_Add(entityHandle, className, fieldName, size);
+}
+
+static void CB_WatchRemove(int32_t watchId) {
+    gostrike::PropertyWatch_Remove(watchId);
+}
+
+// ============================================================
+// V6 Callbacks: Field Paths
+// ============================================================
+
+static int32_t CB_PathCompile(const char* path) {
+    return gostrike::FieldPath_Compile(path);
+}
+
+static int32_t CB_PathRead(int32_t pathId, const uint32_t* entityHandles, int32_t count,
+                           int32_t size, uint8_t* out, bool* valid) {
+    return gostrike::FieldPath_Read(pathId, entityHandles, count, size, out, valid);
+}
+
+// ============================================================
+// V6 Callbacks: Array Fields
+// ============================================================
+
+static int32_t CB_EntityReadArray(void* entity, const char* className, const char* fieldName,
+                                  int32_t kind, int32_t length, int32_t elemSize,
+                                  void* out, int32_t maxCount) {
+    return gostrike::EntityArray_Read(entity, className, fieldName, kind, length, elemSize, out, maxCount);
+}
+
+static int32_t CB_EntityReadHandles(void* entity, const char* className, const char* fieldName,
+                                    int32_t kind, int32_t length,
+                                    gs_entity_ref_t* out, int32_t maxCount) {
+    return gostrike::EntityArray_ReadHandles(entity, className, fieldName, kind, length, out, maxCount);
+}
+
+// ============================================================
+// V6 Callbacks: Interned Strings
+// ============================================================
+
+static const char* CB_StringGet(uint32_t id) {
+    return gostrike::StringTable_Get(id);
+}
+
+static uint32_t CB_EntityClassnameId(void* entity) {
+    return gostrike::StringTable_Intern(gostrike::EntitySystem_GetEntityClassname(entity));
+}
+
 // ============================================================
 // V5: TakeDamage Go Export
 // ============================================================
@@ -621,6 +841,21 @@ static void CB_PlayerDropWeapons(int32_t slot) {
 // V5 function pointer for damage hook
 static gs_event_result_t (*pfn_GoStrike_OnTakeDamage)(int32_t, int32_t, float, int32_t) = nullptr;
 
+// V6 function pointer for batched entity output/touch events
+static void (*pfn_GoStrike_OnEntityEvents)(gs_entity_event_t*, int32_t) = nullptr;
+
+// V6 function pointer for escalated weapon pickup/acquire decisions
+static gs_event_result_t (*pfn_GoStrike_OnItemAcquire)(int32_t, int32_t, int32_t) = nullptr;
+
+// V6 function pointer for generic function hooks
+static gs_hook_result_t (*pfn_GoStrike_OnHook)(gs_hook_frame_t*) = nullptr;
+
+// V6 function pointer for per-frame player input delivery
+static void (*pfn_GoStrike_OnPlayerInput)(gs_input_frame_t*) = nullptr;
+
+// V6 function pointer for batched property watch changes
+static void (*pfn_GoStrike_OnPropertyChanges)(gs_watch_change_t*, int32_t) = nullptr;
+
 // ============================================================
 // Bridge Implementation
 // ============================================================
@@ -709,6 +944,13 @@ bool GoBridge_Init() {
     // V5 symbols (optional)
     pfn_GoStrike_OnTakeDamage = (decltype(pfn_GoStrike_OnTakeDamage))dlsym(g_goLib, "GoStrike_OnTakeDamage");
 
+    // V6 symbols (optional)
+    pfn_GoStrike_OnEntityEvents = (decltype(pfn_GoStrike_OnEntityEvents))dlsym(g_goLib, "GoStrike_OnEntityEvents");
+    pfn_GoStrike_OnItemAcquire = (decltype(pfn_GoStrike_OnItemAcquire))dlsym(g_goLib, "GoStrike_OnItemAcquire");
+    pfn_GoStrike_OnHook = (decltype(pfn_GoStrike_OnHook))dlsym(g_goLib, "GoStrike_OnHook");
+    pfn_GoStrike_OnPlayerInput = (decltype(pfn_GoStrike_OnPlayerInput))dlsym(g_goLib, "GoStrike_OnPlayerInput");
+    pfn_GoStrike_OnPropertyChanges = (decltype(pfn_GoStrike_OnPropertyChanges))dlsym(g_goLib, "GoStrike_OnPropertyChanges");
+
     printf("[GoStrike] All Go symbols loaded\n");
     if (pfn_GoStrike_OnEntityCreated) {
         printf("[GoStrike] V2 entity lifecycle symbols available\n");
@@ -821,6 +1063,45 @@ void GoBridge_RegisterCallbacks() {
     callbacks.give_named_item = CB_GiveNamedItem;
     callbacks.player_drop_weapons = CB_PlayerDropWeapons;
 
+    // === V6 (Batched Native Subsystems) ===
+    callbacks.find_entities_by_classname = CB_FindEntitiesByClassname;
+    callbacks.get_entity_handle = CB_GetEntityHandle;
+    callbacks.spawn_entities = CB_SpawnEntities;
+    callbacks.remove_entities = CB_RemoveEntities;
+    callbacks.fire_inputs = CB_FireInputs;
+    callbacks.subscribe_entity_output = CB_SubscribeEntityOutput;
+    callbacks.subscribe_trigger_touch = CB_SubscribeTriggerTouch;
+    callbacks.transmit_set_hidden = CB_TransmitSetHidden;
+    callbacks.transmit_clear = CB_TransmitClear;
+    callbacks.visibility_configure = CB_VisibilityConfigure;
+    callbacks.visibility_get_matrix = CB_VisibilityGetMatrix;
+    callbacks.trace_batch = CB_TraceBatch;
+    callbacks.trace_available = CB_TraceAvailable;
+    callbacks.player_ops_submit = CB_PlayerOpsSubmit;
+    callbacks.weapon_list = CB_WeaponList;
+    callbacks.give_items = CB_GiveItems;
+    callbacks.item_rules_set = CB_ItemRulesSet;
+    callbacks.item_set_limit = CB_ItemSetLimit;
+    callbacks.item_set_count = CB_ItemSetCount;
+    callbacks.item_rules_clear = CB_ItemRulesClear;
+    callbacks.hook_define = CB_HookDefine;
+    callbacks.hook_subscribe = CB_HookSubscribe;
+    callbacks.call_define = CB_CallDefine;
+    callbacks.call_invoke = CB_CallInvoke;
+    callbacks.get_gamerules = CB_GetGameRules;
+    callbacks.terminate_round = CB_TerminateRound;
+    callbacks.input_capture = CB_InputCapture;
+    callbacks.history_query = CB_HistoryQuery;
+    callbacks.history_latest_tick = CB_HistoryLatestTick;
+    callbacks.watch_add = CB_WatchAdd;
+    callbacks.watch_remove = CB_WatchRemove;
+    callbacks.path_compile = CB_PathCompile;
+    callbacks.path_read = CB_PathRead;
+    callbacks.entity_read_array = CB_EntityReadArray;
+    callbacks.entity_read_handles = CB_EntityReadHandles;
+    callbacks.string_get = CB_StringGet;
+    callbacks.entity_classname_id = CB_EntityClassnameId;
+
     pfn_GoStrike_RegisterCallbacks(&callbacks);
     printf("[GoStrike] Callbacks registered with Go runtime\n");
 }
@@ -882,6 +1163,7 @@ gs_event_result_t GoBridge_FireEvent(const char* name, void* event, bool isPost)
     gsEvent.name_len = (uint32_t)strlen(name);
     gsEvent.native_event = event;
     gsEvent.can_modify = !isPost;
+    gsEvent.name_id = gostrike::StringTable_Intern(name);
     
     return pfn_GoStrike_OnEvent(&gsEvent, isPost);
 }
@@ -890,7 +1172,7 @@ void GoBridge_OnPlayerConnect(gs_player_t* player) {
     if (!g_initialized || !pfn_GoStrike_OnPlayerConnect || !player) {
         return;
     }
-    
+
     // Cache player data
     int slot = player->slot;
     if (slot >= 0 && slot < 64) {
@@ -947,12 +1229,12 @@ void GoBridge_OnMapChange(const char* mapName) {
 
 void GoBridge_OnEntityCreated(uint32_t index, const char* classname) {
     if (!g_initialized || !pfn_GoStrike_OnEntityCreated) return;
-    pfn_GoStrike_OnEntityCreated(index, classname);
+    pfn_GoStrike_OnEntityCreated(index, gostrike::StringTable_Intern(classname));
 }
 
 void GoBridge_OnEntitySpawned(uint32_t index, const char* classname) {
     if (!g_initialized || !pfn_GoStrike_OnEntitySpawned) return;
-    pfn_GoStrike_OnEntitySpawned(index, classname);
+    pfn_GoStrike_OnEntitySpawned(index, gostrike::StringTable_Intern(classname));
 }
 
 void GoBridge_OnEntityDeleted(uint32_t index) {
@@ -975,6 +1257,37 @@ gs_event_result_t GoBridge_OnTakeDamage(int32_t victimIndex, int32_t attackerInd
     return pfn_GoStrike_OnTakeDamage(victimIndex, attackerIndex, damage, damageType);
 }
 
+void GoBridge_OnEntityEvents(gs_entity_event_t* events, int32_t count) {
+    if (!g_initialized || !pfn_GoStrike_OnEntityEvents || !events || count <= 0) return;
+    pfn_GoStrike_OnEntityEvents(events, count);
+}
+
+gs_event_result_t GoBridge_OnItemAcquire(int32_t slot, int32_t itemId, int32_t method) {
+    if (!g_initialized || !pfn_GoStrike_OnItemAcquire) {
+        return GS_EVENT_CONTINUE;
+    }
+    return pfn_GoStrike_OnItemAcquire(slot, itemId, method);
+}
+
+gs_hook_result_t GoBridge_OnHook(gs_hook_frame_t* frame) {
+    if (!g_initialized || !pfn_GoStrike_OnHook || !frame) {
+        return GS_HOOK_CONTINUE;
+    }
+    return pfn_GoStrike_OnHook(frame);
+}
+
+void GoBridge_OnPlayerInput(gs_input_frame_t* frame) {
+    if (!g_initialized || !pfn_GoStrike_OnPlayerInput || !frame) {
+        return;
+    }
+    pfn_GoStrike_OnPlayerInput(frame);
+}
+
+void GoBridge_OnPropertyChanges(gs_watch_change_t* changes, int32_t count) {
+    if (!g_initialized || !pfn_GoStrike_OnPropertyChanges || !changes || count <= 0) return;
+    pfn_GoStrike_OnPropertyChanges(changes, count);
+}
+
 bool GoBridge_OnChatMessage(int32_t playerSlot, const char* message) {
     if (!g_initialized || !pfn_GoStrike_OnChatMessage || !message) {
         return false;
@@ -987,3 +1300,10 @@ void GoBridge_RefreshPlayerCache() {
     RefreshPlayerCache();
 #endif
 }
+
+void GoBridge_Warmup() {
+#ifndef USE_STUB_SDK
+    s_originPath = gostrike::FieldPath_Compile(
+        "CBaseEntity.m_CBodyComponent->CBodyComponent.m_pSceneNode->CGameSceneNode.m_vecAbsOrigin");
+#endif
+}
@@ -46,10 +46,28 @@ void GoBridge_OnEntityDeleted(uint32_t index);
 gs_event_result_t GoBridge_OnTakeDamage(int32_t victimIndex, int32_t attackerIndex,
                                          float damage, int32_t damageType);
 
+// Deliver a frame's batch of entity output/touch events to Go
+void GoBridge_OnEntityEvents(gs_entity_event_t* events, int32_t count);
+
+// Ask Go about an escalated item acquisition (GS_EVENT_HANDLED or higher denies)
+gs_event_result_t GoBridge_OnItemAcquire(int32_t slot, int32_t itemId, int32_t method);
+
+// Run Go's handlers for a generic function hook
+gs_hook_result_t GoBridge_OnHook(gs_hook_frame_t* frame);
+
+// Deliver the player inputs captured since the last frame to Go
+void GoBridge_OnPlayerInput(gs_input_frame_t* frame);
+
+// Deliver a frame's property watch changes to Go
+void GoBridge_OnPropertyChanges(gs_watch_change_t* changes, int32_t count);
+
 // Get the last error message from Go (caller must free)
 char* GoBridge_GetLastError(void);
 
 // Refresh player cache from entity system (call from game thread only)
 void GoBridge_RefreshPlayerCache(void);
 
+// Compile the field paths the player cache reads (load and map start)
+void GoBridge_Warmup(void);
+
 #endif // GO_BRIDGE_H
@@ -9,6 +9,23 @@
 #include "convar_manager.h"
 #include "game_functions.h"
 #include "chat_manager.h"
+#include "spawn_manager.h"
+#include "entity_io.h"
+#include "entity_hooks.h"
+#include "transmit_manager.h"
+#include "trace_manager.h"
+#include "visibility_manager.h"
+#include "weapon_registry.h"
+#include "item_rules.h"
+#include "hook_manager.h"
+#include "native_calls.h"
+#include "vtable_analyzer.h"
+#include "gamerules.h"
+#include "input_capture.h"
+#include "player_history.h"
+#include "property_watch.h"
+#include "field_path.h"
+#include "string_table.h"
 #include <stdio.h>
 
 #ifndef USE_STUB_SDK
@@ -35,6 +52,7 @@ IServerGameClients*    gs_pServerGameClients = nullptr;
 CGlobalVars*           gs_pGlobals = nullptr;
 IGameResourceService*  gs_pGameResourceService = nullptr;
 INetworkServerService* gs_pNetworkServerService = nullptr;
+ISource2GameEntities*  gs_pSource2GameEntities = nullptr;
 #else
 void* gs_pEngineServer2 = nullptr;
 void* gs_pSource2Server = nullptr;
@@ -47,6 +65,7 @@ void* gs_pServerGameClients = nullptr;
 void* gs_pGlobals = nullptr;
 void* gs_pGameResourceService = nullptr;
 void* gs_pNetworkServerService = nullptr;
+void* gs_pSource2GameEntities = nullptr;
 #endif
 
 // Provide the GameEntitySystem() function that the SDK's entity2 code expects.
@@ -77,6 +96,58 @@ static void ConPrintf(const char* fmt, ...) {
     ConPrint(buffer);
 }
 
+// ============================================================
+// Map Lifecycle
+// ============================================================
+
+#ifndef USE_STUB_SDK
+// True between map start and map end
+static bool g_bMapActive = false;
+
+// Classes whose fields the bridge and native subsystems read most
+static const char* const kPrewarmClasses[] = {
+    "CBaseEntity",
+    "CBaseModelEntity",
+    "CBasePlayerController",
+    "CCSPlayerController",
+    "CBasePlayerPawn",
+    "CCSPlayerPawnBase",
+    "CCSPlayerPawn",
+    "CCSPlayer_ItemServices",
+    "CBasePlayerWeapon",
+    "CCSGameRules",
+};
+
+// Resolve everything that is otherwise resolved on first use, so the first
+// round of a map does not pay for schema walks and signature scans
+static void WarmupCaches() {
+    int32_t fields = 0;
+    for (const char* className : kPrewarmClasses) {
+        fields += gostrike::schema::PrewarmClass(className);
+    }
+    gostrike::GameFunctions_Warmup();
+    gostrike::FieldPath_ClearFailures();
+    GoBridge_Warmup();
+    ConPrintf("[GoStrike] Warm-up: %d schema fields cached\n", fields);
+}
+
+// Drop per-map state: pending notifications and everything keyed by entity
+// handles or indices of the map that is ending
+static void OnMapEnd() {
+    if (!g_bMapActive) return;
+    g_bMapActive = false;
+
+    gostrike::schema::ClearStateChanged();
+    gostrike::GameRules_Reset();
+    gostrike::PlayerHistory_Reset();
+    gostrike::EntityHooks_OnMapEnd();
+    gostrike::TransmitManager_ClearSlot(-1);
+    gostrike::VisibilityManager_OnMapEnd();
+    gostrike::PropertyWatch_OnMapEnd();
+    ConPrintf("[GoStrike] Map ended\n");
+}
+#endif
+
 // ============================================================
 // SourceHook Hook Declarations
 // ============================================================
@@ -94,12 +165,20 @@ SH_DECL_HOOK5_void(IServerGameClients, ClientDisconnect, SH_NOATTRIB, 0, CPlayer
 // Hook into IServerGameClients::ClientPutInServer
 SH_DECL_HOOK4_void(IServerGameClients, ClientPutInServer, SH_NOATTRIB, 0, CPlayerSlot, char const*, int, uint64);
 
+// Hook into ISource2GameEntities::CheckTransmit (per-player entity visibility, see transmit_manager.cpp)
+SH_DECL_HOOK6_void(ISource2GameEntities, CheckTransmit, SH_NOATTRIB, 0, CCheckTransmitInfo**, int, CBitVec<16384>&,
+                   const Entity2Networkable_t**, const uint16*, int);
+
 // Hook into IGameEventManager2::FireEvent (game events like player_death, round_start)
 // Approach from CSSharp: hook LoadEventsFromFile to capture the IGameEventManager2 instance,
 // then hook FireEvent for pre/post game event dispatch
 SH_DECL_HOOK2(IGameEventManager2, FireEvent, SH_NOATTRIB, 0, bool, IGameEvent*, bool);
 SH_DECL_HOOK2(IGameEventManager2, LoadEventsFromFile, SH_NOATTRIB, 0, int, const char*, bool);
 
+// Hook into INetworkServerService::StartupServer (map start; the previous map ends here too)
+SH_DECL_HOOK3_void(INetworkServerService, StartupServer, SH_NOATTRIB, 0, const GameSessionConfiguration_t&,
+                   ISource2WorldSession*, const char*);
+
 static int g_iLoadEventsFromFileHookId = 0;
 static bool g_bFireEventHooked = false;
 
@@ -154,6 +233,9 @@ bool GoStrikePlugin::Load(PluginId id, ISmmAPI* ismm, char* error, size_t maxlen
     GET_V_IFACE_ANY(GetServerFactory, gs_pServerGameClients,
                     IServerGameClients, INTERFACEVERSION_SERVERGAMECLIENTS);
 
+    GET_V_IFACE_ANY(GetServerFactory, gs_pSource2GameEntities,
+                    ISource2GameEntities, SOURCE2GAMEENTITIES_INTERFACE_VERSION);
+
     GET_V_IFACE_ANY(GetEngineFactory, gs_pGameResourceService,
                     IGameResourceService, GAMERESOURCESERVICESERVER_INTERFACE_VERSION);
 
@@ -178,6 +260,12 @@ bool GoStrikePlugin::Load(PluginId id, ISmmAPI* ismm, char* error, size_t maxlen
     SH_ADD_HOOK_MEMFUNC(IServerGameClients, ClientDisconnect, gs_pServerGameClients, &g_Plugin, &GoStrikePlugin::Hook_ClientDisconnect, true);
     SH_ADD_HOOK_MEMFUNC(IServerGameClients, ClientPutInServer, gs_pServerGameClients, &g_Plugin, &GoStrikePlugin::Hook_ClientPutInServer, true);
 
+    // Entity transmit filtering (post: applied after the engine fills the transmit set)
+    SH_ADD_HOOK_MEMFUNC(ISource2GameEntities, CheckTransmit, gs_pSource2GameEntities, &g_Plugin, &GoStrikePlugin::Hook_CheckTransmit, true);
+
+    // Map lifecycle
+    SH_ADD_HOOK_MEMFUNC(INetworkServerService, StartupServer, gs_pNetworkServerService, &g_Plugin, &GoStrikePlugin::Hook_StartupServer, true);
+
     ConPrintf("[GoStrike] SourceHook hooks registered\n");
 
     // ============================================================
@@ -215,6 +303,9 @@ bool GoStrikePlugin::Load(PluginId id, ISmmAPI* ismm, char* error, size_t maxlen
         }
         if (!loaded) {
             ConPrintf("[GoStrike] WARNING: gamedata.json not found, some features may not work\n");
+        } else {
+            // Catch stale vtable indices before anything calls through them
+            gostrike::VTable_ValidateGameData();
         }
     }
 
@@ -227,12 +318,10 @@ bool GoStrikePlugin::Load(PluginId id, ISmmAPI* ismm, char* error, size_t maxlen
     // Hook LoadEventsFromFile on CGameEventManager vtable to capture the runtime instance
     // (same approach as CSSharp - we need the instance pointer before we can hook FireEvent)
     if (gostrike::modules::server.IsInitialized()) {
-        // The vtable symbol for CGameEventManager in ELF: _ZTV20CGameEventManager
-        void* pVTable = gostrike::modules::server.FindSymbol("_ZTV20CGameEventManager");
+        // _ZTV20CGameEventManager symbol, or the RTTI-located vtable when it is hidden
+        void** pVTable = gostrike::VTable_Find(&gostrike::modules::server, "CGameEventManager");
         if (pVTable) {
-            // Skip past the RTTI offset and typeinfo pointer (2 pointers)
-            auto* pVTableStart = reinterpret_cast<IGameEventManager2*>(
-                reinterpret_cast<uintptr_t>(pVTable) + 2 * sizeof(void*));
+            auto* pVTableStart = reinterpret_cast<IGameEventManager2*>(pVTable);
             g_iLoadEventsFromFileHookId = SH_ADD_DVPHOOK(IGameEventManager2, LoadEventsFromFile,
                 pVTableStart, SH_MEMBER(&g_Plugin, &GoStrikePlugin::Hook_LoadEventsFromFile), false);
             ConPrintf("[GoStrike] CGameEventManager vtable found, LoadEventsFromFile hooked\n");
@@ -286,12 +375,39 @@ bool GoStrikePlugin::Unload(char* error, size_t maxlen) {
     }
 
 #ifndef USE_STUB_SDK
+    OnMapEnd();
+
     // Shutdown damage hook
     gostrike::GameFunc_ShutdownDamageHook();
 
     // Shutdown chat manager (unhook Host_Say)
     gostrike::ChatManager_Shutdown();
 
+    // Remove entity output / trigger touch hooks
+    gostrike::EntityHooks_Shutdown();
+
+    // Remove weapon pickup/acquire hooks
+    gostrike::ItemRules_Shutdown();
+
+    // Detach input capture, then remove generic function hooks
+    gostrike::InputCapture_Shutdown();
+    gostrike::HookManager_Shutdown();
+
+    // Drop native call definitions
+    gostrike::NativeCalls_Shutdown();
+
+    // Drop property watches
+    gostrike::PropertyWatch_Shutdown();
+
+    // Drop compiled field paths
+    gostrike::FieldPath_Shutdown();
+
+    // Discard unflushed state change notifications
+    gostrike::schema::ClearStateChanged();
+
+    // Release interned I/O strings
+    gostrike::EntityIO_Shutdown();
+
     // Shutdown entity system
     gostrike::EntitySystem_Shutdown();
 
@@ -316,12 +432,17 @@ bool GoStrikePlugin::Unload(char* error, size_t maxlen) {
     SH_REMOVE_HOOK_MEMFUNC(IServerGameClients, ClientConnect, gs_pServerGameClients, &g_Plugin, &GoStrikePlugin::Hook_ClientConnect, false);
     SH_REMOVE_HOOK_MEMFUNC(IServerGameClients, ClientDisconnect, gs_pServerGameClients, &g_Plugin, &GoStrikePlugin::Hook_ClientDisconnect, true);
     SH_REMOVE_HOOK_MEMFUNC(IServerGameClients, ClientPutInServer, gs_pServerGameClients, &g_Plugin, &GoStrikePlugin::Hook_ClientPutInServer, true);
+    SH_REMOVE_HOOK_MEMFUNC(ISource2GameEntities, CheckTransmit, gs_pSource2GameEntities, &g_Plugin, &GoStrikePlugin::Hook_CheckTransmit, true);
+    SH_REMOVE_HOOK_MEMFUNC(INetworkServerService, StartupServer, gs_pNetworkServerService, &g_Plugin, &GoStrikePlugin::Hook_StartupServer, true);
     ConPrintf("[GoStrike] SourceHook hooks removed\n");
 #endif
 
     // Shutdown Go runtime
     GoBridge_Shutdown();
 
+    // Drop interned strings; Go held their IDs until now
+    gostrike::StringTable_Shutdown();
+
     ConPrintf("[GoStrike] Plugin unloaded\n");
     return true;
 }
@@ -349,12 +470,48 @@ void GoStrikePlugin::AllPluginsLoaded() {
     // Initialize game function pointers from gamedata
     gostrike::GameFunctions_Initialize();
 
+    // Item name/ID tables and weapon data lookup
+    gostrike::WeaponRegistry_Initialize();
+
+    // Gamerules pointer, round-state snapshot and TerminateRound
+    gostrike::GameRules_Initialize();
+
+    // Per-tick input capture (PostThink handler attached on demand)
+    gostrike::InputCapture_Initialize();
+
+    // Per-player origin/angle/velocity history rings
+    gostrike::PlayerHistory_Initialize();
+
+    // Resolve entity creation/removal functions from gamedata
+    gostrike::SpawnManager_Initialize();
+
+    // Resolve AcceptInput/AddEntityIOEvent for entity inputs
+    gostrike::EntityIO_Initialize();
+
+    // Install entity output / trigger touch hooks
+    gostrike::EntityHooks_Initialize();
+
+    // Per-player transmit filter (CheckTransmit hook is registered in Load)
+    gostrike::TransmitManager_Initialize();
+
+    // Engine traces and the line-of-sight matrix (idle until configured from Go)
+    gostrike::TraceManager_Initialize();
+    gostrike::VisibilityManager_Initialize();
+
+    // Weapon pickup/acquire restrictions (CanUse/CanAcquire detours)
+    gostrike::ItemRules_Initialize();
+
     // Initialize damage hook (funchook on CBaseEntity_TakeDamageOld)
     gostrike::GameFunc_InitDamageHook();
 
     // Initialize chat manager (TextMsg outbound + Host_Say hook for inbound)
     gostrike::ChatManager_Initialize();
 
+    // Warm caches now; on a late load the current map started before
+    // StartupServer was hooked, so this is its only warm-up
+    WarmupCaches();
+    if (m_bLateLoad) g_bMapActive = true;
+
     // Hook FireEvent on IGameEventManager2 if we captured the instance
     if (gs_pGameEventManager && !g_bFireEventHooked) {
         SH_ADD_HOOK_MEMFUNC(IGameEventManager2, FireEvent, gs_pGameEventManager,
@@ -442,10 +599,12 @@ void GoStrikePlugin::Hook_GameFrame(bool simulating, bool bFirstTick, bool bLast
     // Calculate delta time from globals
     static float lastTime = 0.0f;
     float currentTime = 0.0f;
+    int32_t currentTick = 0;
 
 #ifndef USE_STUB_SDK
     if (gs_pGlobals) {
         currentTime = gs_pGlobals->curtime;
+        currentTick = gs_pGlobals->tickcount;
     }
 #endif
 
@@ -453,14 +612,64 @@ void GoStrikePlugin::Hook_GameFrame(bool simulating, bool bFirstTick, bool bLast
     if (deltaTime < 0.0f) deltaTime = 0.0f;  // Handle map change time resets
     lastTime = currentTime;
 
+    // Install generic hooks defined since the last frame (one funchook transaction)
+    gostrike::HookManager_InstallPending();
+
     GoBridge_RefreshPlayerCache();
+    gostrike::PlayerHistory_Record(currentTick);
+    gostrike::GameRules_OnGameFrame();
+
+    // Deliver subscribed output/touch events recorded since the last frame
+    gostrike::EntityHooks_Flush();
+
+    // Deliver player inputs captured by PostThink since the last frame
+    gostrike::InputCapture_OnGameFrame();
+
+    // Diff watched entity properties and deliver changes
+    gostrike::PropertyWatch_OnGameFrame();
+
+    // Advance the line-of-sight sweep within its per-tick budget
+    gostrike::VisibilityManager_OnGameFrame();
 
     // Dispatch tick to Go
     GoBridge_OnTick(deltaTime);
 
+    // Report this frame's networked field writes, once per field, before networking
+    gostrike::schema::FlushStateChanged();
+
     RETURN_META(MRES_IGNORED);
 }
 
+#ifndef USE_STUB_SDK
+void GoStrikePlugin::Hook_StartupServer(const GameSessionConfiguration_t& config, ISource2WorldSession* pSession,
+                                        const char* pszMapName) {
+    (void)config;
+    (void)pSession;
+
+    // A new map implies the previous one is over
+    OnMapEnd();
+
+    // CGlobalVars is recreated with the server
+    gs_pGlobals = nullptr;
+    if (auto* gameServer = gs_pNetworkServerService->GetIGameServer()) {
+        gs_pGlobals = gameServer->GetGlobals();
+    }
+
+    // So is the entity system; re-register the listener with the new one
+    gostrike::EntitySystem_Refresh();
+
+    WarmupCaches();
+    gostrike::WeaponRegistry_OnMapStart();
+    g_bMapActive = true;
+
+    const char* mapName = pszMapName ? pszMapName : "";
+    ConPrintf("[GoStrike] Map started: %s\n", mapName);
+    GoBridge_OnMapChange(mapName);
+
+    RETURN_META(MRES_IGNORED);
+}
+#endif
+
 bool GoStrikePlugin::Hook_ClientConnect(CPlayerSlot slot, const char* pszName,
                                         uint64 xuid, const char* pszNetworkID,
                                         bool unk1, CBufferString* pRejectReason) {
@@ -487,9 +696,24 @@ void GoStrikePlugin::Hook_ClientDisconnect(CPlayerSlot slot, ENetworkDisconnecti
 
     GoBridge_OnPlayerDisconnect(slot.Get(), "disconnect");
 
+    // Don't carry hidden entities over to the next player in this slot
+    gostrike::TransmitManager_ClearSlot(slot.Get());
+    gostrike::ItemRules_ClearSlot(slot.Get());
+    gostrike::PlayerHistory_ClearSlot(slot.Get());
+
     RETURN_META(MRES_IGNORED);
 }
 
+#ifndef USE_STUB_SDK
+void GoStrikePlugin::Hook_CheckTransmit(CCheckTransmitInfo** ppInfoList, int infoCount,
+                                        CBitVec<16384>& unionTransmitEdicts,
+                                        const Entity2Networkable_t** pNetworkables,
+                                        const uint16* pEntityIndicies, int nEntities) {
+    gostrike::TransmitManager_Apply(reinterpret_cast<void**>(ppInfoList), infoCount);
+    RETURN_META(MRES_IGNORED);
+}
+#endif
+
 void GoStrikePlugin::Hook_ClientPutInServer(CPlayerSlot slot, char const* pszName,
                                             int type, uint64 xuid) {
     ConPrintf("[GoStrike] Client put in server: %s (slot %d)\n", pszName, slot.Get());
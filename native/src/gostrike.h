@@ -87,6 +87,18 @@ public:
 
     // Note: Chat interception uses funchook on Host_Say (see chat_manager.cpp)
 
+#ifndef USE_STUB_SDK
+    // Map start (INetworkServerService::StartupServer post-hook)
+    void Hook_StartupServer(const GameSessionConfiguration_t& config, ISource2WorldSession* pSession,
+                            const char* pszMapName);
+
+    // Per-player entity transmit filter (ISource2GameEntities::CheckTransmit post-hook)
+    void Hook_CheckTransmit(CCheckTransmitInfo** ppInfoList, int infoCount,
+                            CBitVec<16384>& unionTransmitEdicts,
+                            const Entity2Networkable_t** pNetworkables,
+                            const uint16* pEntityIndicies, int nEntities);
+#endif
+
 private:
     bool m_bLateLoad;
 };
@@ -107,6 +119,7 @@ extern IServerGameClients*     gs_pServerGameClients;
 extern CGlobalVars*            gs_pGlobals;
 extern IGameResourceService*   gs_pGameResourceService;
 extern INetworkServerService*  gs_pNetworkServerService;
+extern ISource2GameEntities*   gs_pSource2GameEntities;
 #else
 extern void* gs_pEngineServer2;
 extern void* gs_pSource2Server;
@@ -119,6 +132,7 @@ extern void* gs_pServerGameClients;
 extern void* gs_pGlobals;
 extern void* gs_pGameResourceService;
 extern void* gs_pNetworkServerService;
+extern void* gs_pSource2GameEntities;
 #endif
 
 // Metamod globals
@@ -0,0 +1,348 @@
+// hook_manager.cpp - Generic gamedata-driven function hooks
+//
+// Each hook owns one slot of a fixed pool of detour thunks. A thunk has the
+// register-file shape from register_args.h, so it can stand in for any function
+// whose arguments all travel in registers (no stack arguments, no by-value
+// structs). Two thunk families exist: one returns in RAX, the other in XMM0.
+//
+// With no handlers attached a thunk costs one branch before tail-calling the
+// original. Detours are prepared on definition and installed together on the
+// next game frame, so plugins defining several hooks during load share a
+// single funchook transaction.
+
+#include "hook_manager.h"
+#include "gameconfig.h"
+#include "go_bridge.h"
+#include "register_args.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef USE_STUB_SDK
+#include <funchook.h>
+#endif
+
+namespace gostrike {
+
+#ifndef USE_STUB_SDK
+static constexpr int kMaxHooks = 64;
+
+struct HookReturn {
+    uint64_t i;
+    double f;
+};
+
+struct ChainEntry {
+    HookHandlerFn fn;
+    void* user;
+};
+
+struct HookDef {
+    std::string name;
+    int32_t retType;
+    int32_t argc;
+    int32_t argTypes[GS_HOOK_MAX_ARGS];
+    int8_t argReg[GS_HOOK_MAX_ARGS];  // Index into RegFile::i or RegFile::f
+    void* original;                   // Target until installed, then the trampoline
+    bool installed;
+    bool failed;                      // Install failed; the name stays taken, the ID is dead
+    bool active;                      // Any handler attached (the thunk fast path)
+    std::vector<ChainEntry> pre;
+    std::vector<ChainEntry> post;
+    int goSubscribers[2];             // [pre, post]
+};
+
+static HookDef s_hooks[kMaxHooks];
+static int32_t s_hookCount = 0;
+
+static funchook_t* s_pPending = nullptr;
+static std::vector<int32_t> s_pendingIds;
+static std::vector<funchook_t*> s_installed;
+
+static int32_t RunChain(const std::vector<ChainEntry>& chain, gs_hook_frame_t* frame) {
+    int32_t result = GS_HOOK_CONTINUE;
+    // Indexed loop: a handler may subscribe/unsubscribe while the chain runs
+    for (size_t i = 0; i < chain.size(); i++) {
+        int32_t r = chain[i].fn(frame, chain[i].user);
+        if (r > result) result = r;
+    }
+    return result;
+}
+
+static HookReturn Dispatch(int32_t id, RegFile& regs) {
+    HookDef& h = s_hooks[id];
+
+    gs_hook_frame_t frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.hook_id = id;
+    frame.argc = h.argc;
+    for (int32_t a = 0; a < h.argc; a++) {
+        frame.args[a] = PackRegArg(h.argTypes[a], regs, h.argReg[a]);
+    }
+
+    int32_t result = RunChain(h.pre, &frame);
+    if (result >= GS_HOOK_SUPERCEDE) {
+        frame.superceded = true;
+    } else {
+        if (result == GS_HOOK_CHANGED) {
+            for (int32_t a = 0; a < h.argc; a++) {
+                UnpackRegArg(h.argTypes[a], frame.args[a], regs, h.argReg[a]);
+            }
+        }
+
+        frame.ret = CallWithRegisters(h.original, h.retType, regs);
+    }
+
+    if (!h.post.empty()) {
+        frame.post = true;
+        RunChain(h.post, &frame);
+    }
+
+    HookReturn ret;
+    ret.i = frame.ret;
+    ret.f = BitsDouble(frame.ret);
+    return ret;
+}
+
+template <int N>
+static uint64_t IntThunk(uint64_t i0, uint64_t i1, uint64_t i2, uint64_t i3, uint64_t i4, uint64_t i5,
+                         double f0, double f1, double f2, double f3, double f4, double f5, double f6, double f7) {
+    HookDef& h = s_hooks[N];
+    if (!h.active) {
+        return reinterpret_cast<IntRegFn>(h.original)(i0, i1, i2, i3, i4, i5, f0, f1, f2, f3, f4, f5, f6, f7);
+    }
+    RegFile regs = {{i0, i1, i2, i3, i4, i5}, {f0, f1, f2, f3, f4, f5, f6, f7}};
+    return Dispatch(N, regs).i;
+}
+
+template <int N>
+static double FloatThunk(uint64_t i0, uint64_t i1, uint64_t i2, uint64_t i3, uint64_t i4, uint64_t i5,
+                         double f0, double f1, double f2, double f3, double f4, double f5, double f6, double f7) {
+    HookDef& h = s_hooks[N];
+    if (!h.active) {
+        return reinterpret_cast<FloatRegFn>(h.original)(i0, i1, i2, i3, i4, i5, f0, f1, f2, f3, f4, f5, f6, f7);
+    }
+    RegFile regs = {{i0, i1, i2, i3, i4, i5}, {f0, f1, f2, f3, f4, f5, f6, f7}};
+    return Dispatch(N, regs).f;
+}
+
+template <int... N>
+static std::vector<void*> MakeIntThunks(std::integer_sequence<int, N...>) {
+    return {reinterpret_cast<void*>(&IntThunk<N>)...};
+}
+
+template <int... N>
+static std::vector<void*> MakeFloatThunks(std::integer_sequence<int, N...>) {
+    return {reinterpret_cast<void*>(&FloatThunk<N>)...};
+}
+
+static const std::vector<void*> s_intThunks = MakeIntThunks(std::make_integer_sequence<int, kMaxHooks>{});
+static const std::vector<void*> s_floatThunks = MakeFloatThunks(std::make_integer_sequence<int, kMaxHooks>{});
+
+static void UpdateActive(HookDef& h) {
+    h.active = h.installed && (!h.pre.empty() || !h.post.empty());
+}
+
+static int32_t GoChainHandler(gs_hook_frame_t* frame, void*) {
+    return GoBridge_OnHook(frame);
+}
+
+static bool SameSignature(const HookDef& h, int32_t retType, const int32_t* argTypes, int32_t argc) {
+    if (h.retType != retType || h.argc != argc) return false;
+    for (int32_t a = 0; a < argc; a++) {
+        if (h.argTypes[a] != argTypes[a]) return false;
+    }
+    return true;
+}
+#endif
+
+int32_t HookManager_Define(const char* name, int32_t retType, const int32_t* argTypes, int32_t argc) {
+#ifndef USE_STUB_SDK
+    if (!name || argc < 0 || argc > GS_HOOK_MAX_ARGS || (argc > 0 && !argTypes)) return -1;
+    if (retType < GS_HOOK_TYPE_VOID || retType > GS_HOOK_TYPE_VECTOR) return -1;
+
+    for (int32_t id = 0; id < s_hookCount; id++) {
+        if (s_hooks[id].name == name) {
+            if (s_hooks[id].failed) {
+                printf("[GoStrike] HookManager: %s failed to install earlier, not hooking it again\n", name);
+                return -1;
+            }
+            if (SameSignature(s_hooks[id], retType, argTypes, argc)) return id;
+            printf("[GoStrike] HookManager: %s already defined with a different signature\n", name);
+            return -1;
+        }
+    }
+
+    if (s_hookCount >= kMaxHooks) {
+        printf("[GoStrike] HookManager: hook pool exhausted (%d), cannot hook %s\n", kMaxHooks, name);
+        return -1;
+    }
+
+    // Assign argument registers; only register-passed signatures are supported
+    HookDef def;
+    def.name = name;
+    def.retType = retType;
+    def.argc = argc;
+    for (int32_t a = 0; a < argc; a++) {
+        def.argTypes[a] = argTypes[a];
+    }
+    if (!AssignArgRegisters(argTypes, argc, def.argReg)) {
+        printf("[GoStrike] HookManager: %s: invalid argument types or arguments do not fit in registers\n", name);
+        return -1;
+    }
+
+    void* target = g_gameConfig.ResolveSignature(name);
+    if (!target) {
+        printf("[GoStrike] HookManager: %s signature not found\n", name);
+        return -1;
+    }
+
+    if (!s_pPending) {
+        s_pPending = funchook_create();
+        if (!s_pPending) {
+            printf("[GoStrike] HookManager: funchook_create() failed\n");
+            return -1;
+        }
+    }
+
+    int32_t id = s_hookCount;
+    HookDef& h = s_hooks[id];
+    h = std::move(def);
+    h.original = target;
+    h.installed = false;
+    h.failed = false;
+    h.active = false;
+    h.goSubscribers[0] = h.goSubscribers[1] = 0;
+
+    void* thunk = IsFloatArgType(retType) ? s_floatThunks[id] : s_intThunks[id];
+    if (funchook_prepare(s_pPending, &h.original, thunk) != 0) {
+        printf("[GoStrike] HookManager: funchook_prepare(%s) failed: %s\n",
+               name, funchook_error_message(s_pPending));
+        h = HookDef();
+        return -1;
+    }
+
+    s_hookCount++;
+    s_pendingIds.push_back(id);
+    return id;
+#else
+    (void)name;
+    (void)retType;
+    (void)argTypes;
+    (void)argc;
+    return -1;
+#endif
+}
+
+bool HookManager_AddHandler(int32_t id, bool post, HookHandlerFn fn, void* user) {
+#ifndef USE_STUB_SDK
+    if (id < 0 || id >= s_hookCount || !fn || s_hooks[id].failed) return false;
+    HookDef& h = s_hooks[id];
+    (post ? h.post : h.pre).push_back({fn, user});
+    UpdateActive(h);
+    return true;
+#else
+    (void)id;
+    (void)post;
+    (void)fn;
+    (void)user;
+    return false;
+#endif
+}
+
+void HookManager_RemoveHandler(int32_t id, bool post, HookHandlerFn fn, void* user) {
+#ifndef USE_STUB_SDK
+    if (id < 0 || id >= s_hookCount) return;
+    HookDef& h = s_hooks[id];
+    auto& chain = post ? h.post : h.pre;
+    for (auto it = chain.begin(); it != chain.end(); ++it) {
+        if (it->fn == fn && it->user == user) {
+            chain.erase(it);
+            break;
+        }
+    }
+    UpdateActive(h);
+#else
+    (void)id;
+    (void)post;
+    (void)fn;
+    (void)user;
+#endif
+}
+
+void HookManager_SubscribeGo(int32_t id, bool post, bool enable) {
+#ifndef USE_STUB_SDK
+    if (id < 0 || id >= s_hookCount || s_hooks[id].failed) return;
+    int& count = s_hooks[id].goSubscribers[post ? 1 : 0];
+    if (enable) {
+        if (count++ == 0) HookManager_AddHandler(id, post, GoChainHandler, nullptr);
+    } else if (count > 0) {
+        if (--count == 0) HookManager_RemoveHandler(id, post, GoChainHandler, nullptr);
+    }
+#else
+    (void)id;
+    (void)post;
+    (void)enable;
+#endif
+}
+
+void HookManager_InstallPending() {
+#ifndef USE_STUB_SDK
+    if (!s_pPending) return;
+
+    funchook_t* batch = s_pPending;
+    s_pPending = nullptr;
+
+    if (funchook_install(batch, 0) != 0) {
+        printf("[GoStrike] HookManager: funchook_install() failed: %s\n", funchook_error_message(batch));
+        funchook_destroy(batch);
+        // The thunks were never patched in and the trampolines are gone with the
+        // batch. Keep the names so a later Define of them fails instead of
+        // handing out an ID that can never be installed.
+        for (int32_t id : s_pendingIds) {
+            HookDef& h = s_hooks[id];
+            h.original = nullptr;
+            h.installed = false;
+            h.failed = true;
+            h.active = false;
+            h.pre.clear();
+            h.post.clear();
+            h.goSubscribers[0] = h.goSubscribers[1] = 0;
+        }
+        s_pendingIds.clear();
+        return;
+    }
+
+    for (int32_t id : s_pendingIds) {
+        s_hooks[id].installed = true;
+        UpdateActive(s_hooks[id]);
+    }
+    printf("[GoStrike] HookManager: installed %zu hook(s)\n", s_pendingIds.size());
+    s_pendingIds.clear();
+    s_installed.push_back(batch);
+#endif
+}
+
+void HookManager_Shutdown() {
+#ifndef USE_STUB_SDK
+    for (funchook_t* batch : s_installed) {
+        funchook_uninstall(batch, 0);
+        funchook_destroy(batch);
+    }
+    s_installed.clear();
+    if (s_pPending) {
+        funchook_destroy(s_pPending);
+        s_pPending = nullptr;
+    }
+    s_pendingIds.clear();
+    for (int32_t id = 0; id < s_hookCount; id++) {
+        s_hooks[id] = HookDef();
+    }
+    s_hookCount = 0;
+#endif
+}
+
+} // namespace gostrike
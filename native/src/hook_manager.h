@@ -0,0 +1,40 @@
+// hook_manager.h - Generic gamedata-driven function hooks
+// Detours any gamedata signature through a pool of precompiled thunks that
+// marshal register arguments into a gs_hook_frame_t by a declared signature,
+// then run pre/post handler chains with supercede support.
+
+#ifndef GOSTRIKE_HOOK_MANAGER_H
+#define GOSTRIKE_HOOK_MANAGER_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Native chain handler. Returns a gs_hook_result_t.
+typedef int32_t (*HookHandlerFn)(gs_hook_frame_t* frame, void* user);
+
+// Define (or look up) a hook on a gamedata signature. The detour is prepared
+// immediately and installed with every other pending hook by InstallPending.
+// Returns the hook ID, or -1 if the signature is unknown, the declaration is
+// unsupported, an existing hook of that name has a different signature, or
+// that hook's install failed (failed hooks are never retried).
+int32_t HookManager_Define(const char* name, int32_t retType, const int32_t* argTypes, int32_t argc);
+
+// Add/remove a native handler on a hook's pre or post chain
+bool HookManager_AddHandler(int32_t id, bool post, HookHandlerFn fn, void* user);
+void HookManager_RemoveHandler(int32_t id, bool post, HookHandlerFn fn, void* user);
+
+// Reference-counted Go subscription: the first subscriber on a chain adds the
+// Go handler, the last one removes it
+void HookManager_SubscribeGo(int32_t id, bool post, bool enable);
+
+// Install every pending detour in one funchook transaction (game thread)
+void HookManager_InstallPending();
+
+// Uninstall all hooks and drop every definition
+void HookManager_Shutdown();
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_HOOK_MANAGER_H
@@ -0,0 +1,137 @@
+// input_capture.cpp - Per-tick player input capture
+//
+// The PostThink handler is only attached while Go captures input; otherwise
+// the (shared) hook costs its usual single branch. PostThink runs after the
+// tick's movement and attacks, so input is only read here, never rewritten.
+
+#include "input_capture.h"
+#include "go_bridge.h"
+#include "hook_manager.h"
+#include "schema.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace gostrike {
+
+static gs_input_frame_t s_frame = {};
+static int32_t s_frameCounter = 0;
+
+#ifndef USE_STUB_SDK
+static int s_captureRefs = 0;
+
+static int32_t s_hookId = -1;
+static bool s_attached = false;
+
+// Schema offsets resolved at init (the handler runs for every pawn every tick)
+static int32_t s_offsetPawnController = 0;  // CBasePlayerPawn::m_hController
+static int32_t s_offsetMovementServices = 0; // CBasePlayerPawn::m_pMovementServices
+static int32_t s_offsetViewAngles = 0;      // CBasePlayerPawn::v_angle
+static int32_t s_offsetButtons = 0;         // CPlayer_MovementServices::m_nButtons + CInButtonState::m_pButtonStates
+static int32_t s_offsetForwardMove = 0;     // CPlayer_MovementServices::m_flForwardMove
+static int32_t s_offsetLeftMove = 0;        // CPlayer_MovementServices::m_flLeftMove
+static int32_t s_offsetUpMove = 0;          // CPlayer_MovementServices::m_flUpMove
+
+template <typename T>
+static T* FieldPtr(void* base, int32_t offset) {
+    return reinterpret_cast<T*>(reinterpret_cast<uintptr_t>(base) + offset);
+}
+
+static int32_t OnPostThink(gs_hook_frame_t* frame, void* /*user*/) {
+    void* pawn = reinterpret_cast<void*>(frame->args[0]);
+    if (!pawn || s_offsetPawnController <= 0) return GS_HOOK_CONTINUE;
+
+    uint32_t handle = *FieldPtr<uint32_t>(pawn, s_offsetPawnController);
+    if (handle == GS_INVALID_HANDLE) return GS_HOOK_CONTINUE;
+    int32_t slot = static_cast<int32_t>(handle & 0x7FFF) - 1;
+    if (slot < 0 || slot >= GS_INPUT_MAX_PLAYERS) return GS_HOOK_CONTINUE;
+
+    void* movement = s_offsetMovementServices > 0 ? *FieldPtr<void*>(pawn, s_offsetMovementServices) : nullptr;
+    const uint64_t* buttons = (movement && s_offsetButtons > 0) ? FieldPtr<uint64_t>(movement, s_offsetButtons) : nullptr;
+    const float* angles = s_offsetViewAngles > 0 ? FieldPtr<float>(pawn, s_offsetViewAngles) : nullptr;
+
+    s_frame.valid |= 1ull << slot;
+    s_frame.buttons[slot] = buttons ? *buttons : 0;
+    if (angles) memcpy(&s_frame.view_angles[slot], angles, sizeof(gs_vector3_t));
+    if (movement) {
+        s_frame.move[slot].x = s_offsetForwardMove > 0 ? *FieldPtr<float>(movement, s_offsetForwardMove) : 0.0f;
+        s_frame.move[slot].y = s_offsetLeftMove > 0 ? *FieldPtr<float>(movement, s_offsetLeftMove) : 0.0f;
+        s_frame.move[slot].z = s_offsetUpMove > 0 ? *FieldPtr<float>(movement, s_offsetUpMove) : 0.0f;
+    }
+    return GS_HOOK_CONTINUE;
+}
+
+// Attach the handler while Go captures input
+static void UpdateHandler() {
+    bool needed = s_captureRefs > 0;
+    if (needed == s_attached) return;
+
+    if (needed) {
+        if (s_hookId < 0) {
+            const int32_t args[] = {GS_HOOK_TYPE_POINTER};
+            s_hookId = HookManager_Define("CCSPlayerPawnBase_PostThink", GS_HOOK_TYPE_VOID, args, 1);
+            if (s_hookId < 0) {
+                printf("[GoStrike] InputCapture: PostThink hook unavailable, input capture disabled\n");
+                return;
+            }
+        }
+        s_attached = HookManager_AddHandler(s_hookId, false, OnPostThink, nullptr);
+    } else {
+        HookManager_RemoveHandler(s_hookId, false, OnPostThink, nullptr);
+        s_attached = false;
+    }
+}
+#endif
+
+void InputCapture_Initialize() {
+#ifndef USE_STUB_SDK
+    s_offsetPawnController = schema::GetOffset("CBasePlayerPawn", "m_hController").offset;
+    s_offsetMovementServices = schema::GetOffset("CBasePlayerPawn", "m_pMovementServices").offset;
+    s_offsetViewAngles = schema::GetOffset("CBasePlayerPawn", "v_angle").offset;
+    int32_t buttonState = schema::GetOffset("CPlayer_MovementServices", "m_nButtons").offset;
+    int32_t buttonStates = schema::GetOffset("CInButtonState", "m_pButtonStates").offset;
+    s_offsetButtons = buttonState > 0 ? buttonState + buttonStates : 0;
+    s_offsetForwardMove = schema::GetOffset("CPlayer_MovementServices", "m_flForwardMove").offset;
+    s_offsetLeftMove = schema::GetOffset("CPlayer_MovementServices", "m_flLeftMove").offset;
+    s_offsetUpMove = schema::GetOffset("CPlayer_MovementServices", "m_flUpMove").offset;
+
+    printf("[GoStrike] InputCapture: initialized (buttons=0x%X, v_angle=0x%X)\n",
+           s_offsetButtons, s_offsetViewAngles);
+#endif
+}
+
+void InputCapture_Enable(bool enable) {
+#ifndef USE_STUB_SDK
+    if (enable) {
+        s_captureRefs++;
+    } else if (s_captureRefs > 0) {
+        s_captureRefs--;
+    }
+    UpdateHandler();
+#else
+    (void)enable;
+#endif
+}
+
+void InputCapture_OnGameFrame() {
+    s_frameCounter++;
+    if (s_frame.valid == 0) return;
+
+    s_frame.frame = s_frameCounter;
+    GoBridge_OnPlayerInput(&s_frame);
+    s_frame.valid = 0;
+}
+
+void InputCapture_Shutdown() {
+#ifndef USE_STUB_SDK
+    if (s_attached) {
+        HookManager_RemoveHandler(s_hookId, false, OnPostThink, nullptr);
+    }
+    s_attached = false;
+    s_hookId = -1;
+    s_captureRefs = 0;
+#endif
+    s_frame.valid = 0;
+}
+
+} // namespace gostrike
@@ -0,0 +1,28 @@
+// input_capture.h - Per-tick player input capture
+// A native pre-handler on CCSPlayerPawnBase_PostThink (through the generic hook
+// manager) records buttons, view angles and move values into a SoA frame that
+// is handed to Go once per game frame.
+
+#ifndef GOSTRIKE_INPUT_CAPTURE_H
+#define GOSTRIKE_INPUT_CAPTURE_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Resolve schema offsets (after schema init)
+void InputCapture_Initialize();
+
+// Reference-counted capture subscription
+void InputCapture_Enable(bool enable);
+
+// Deliver the captured frame to Go and start a new one (game thread, once per frame)
+void InputCapture_OnGameFrame();
+
+// Remove the PostThink handler
+void InputCapture_Shutdown();
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_INPUT_CAPTURE_H
@@ -0,0 +1,307 @@
+// item_rules.cpp - Weapon pickup/acquire restrictions
+// Hook signatures follow CounterStrikeSharp's weapon restriction hooks:
+//   bool CCSPlayer_WeaponServices::CanUse(CBasePlayerWeapon* weapon)
+//   AcquireResult CCSPlayer_ItemServices::CanAcquire(CEconItemView* item, AcquireMethod method, void* unk)
+//
+// CanUse runs every tick a player stands on a dropped weapon, so a decision is
+// a few bit tests; with no rules configured the detours fall straight through.
+
+#include "item_rules.h"
+#include "gameconfig.h"
+#include "entity_system.h"
+#include "schema.h"
+#include "weapon_registry.h"
+#include "go_bridge.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef USE_STUB_SDK
+#include <funchook.h>
+#endif
+
+namespace gostrike {
+
+static constexpr int kMaxSlots = 64;
+static constexpr int kMaxTeams = 4;
+static constexpr int kMaxItems = 128;
+static constexpr int kItemWords = kMaxItems / 64;
+
+// CanAcquire result used for denials (AcquireResult::NotAllowedByProhibition)
+static constexpr int kAcquireNotAllowedByProhibition = 10;
+
+struct ItemBits {
+    uint64_t words[kItemWords];
+
+    bool Test(int32_t id) const { return (words[id >> 6] >> (id & 63)) & 1; }
+    void Set(int32_t id, bool on) {
+        if (on) words[id >> 6] |= 1ull << (id & 63);
+        else words[id >> 6] &= ~(1ull << (id & 63));
+    }
+    bool Any() const {
+        for (int i = 0; i < kItemWords; i++) {
+            if (words[i]) return true;
+        }
+        return false;
+    }
+};
+
+static ItemBits s_teamDeny[kMaxTeams];
+static ItemBits s_teamEscalate[kMaxTeams];
+static ItemBits s_slotDeny[kMaxSlots];
+static int32_t s_teamLimit[kMaxTeams][kMaxItems];
+static int32_t s_teamCount[kMaxTeams][kMaxItems];
+
+// True when any rule or limit is set; the detours skip all work otherwise
+static bool s_active = false;
+static int s_bypassDepth = 0;
+
+static void RecomputeActive() {
+    s_active = false;
+    for (int t = 0; t < kMaxTeams && !s_active; t++) {
+        s_active = s_teamDeny[t].Any() || s_teamEscalate[t].Any();
+        for (int i = 0; i < kMaxItems && !s_active; i++) {
+            s_active = s_teamLimit[t][i] >= 0;
+        }
+    }
+    for (int s = 0; s < kMaxSlots && !s_active; s++) {
+        s_active = s_slotDeny[s].Any();
+    }
+}
+
+// Returns true if the acquisition must be blocked
+static bool IsDenied(int32_t slot, int32_t team, int32_t itemId, int32_t method) {
+    if (itemId < 0 || itemId >= kMaxItems) return false;
+
+    if (slot >= 0 && slot < kMaxSlots && s_slotDeny[slot].Test(itemId)) return true;
+    if (team < 0 || team >= kMaxTeams) return false;
+
+    if (s_teamDeny[team].Test(itemId)) return true;
+    int32_t limit = s_teamLimit[team][itemId];
+    if (limit >= 0 && s_teamCount[team][itemId] >= limit) return true;
+
+    if (s_teamEscalate[team].Test(itemId)) {
+        return GoBridge_OnItemAcquire(slot, itemId, method) >= GS_EVENT_HANDLED;
+    }
+    return false;
+}
+
+#ifndef USE_STUB_SDK
+typedef bool (*CanUseFn)(void* weaponServices, void* weapon);
+typedef int (*CanAcquireFn)(void* itemServices, void* econItem, int method, void* unk);
+
+static CanUseFn s_pOriginalCanUse = nullptr;
+static CanAcquireFn s_pOriginalCanAcquire = nullptr;
+static funchook_t* s_pItemHooks = nullptr;
+
+// Schema offsets resolved at init (the detours must not do string lookups)
+static int32_t s_offsetComponentPawn = 0;    // CPlayerPawnComponent -> pawn pointer
+static int32_t s_offsetPawnController = 0;   // CBasePlayerPawn::m_hController
+static int32_t s_offsetTeamNum = 0;          // CBaseEntity::m_iTeamNum
+static int32_t s_offsetAttributeManager = 0; // CEconEntity::m_AttributeManager
+static int32_t s_offsetContainerItem = 0;    // CAttributeContainer::m_Item
+static int32_t s_offsetItemDefIndex = 0;     // CEconItemView::m_iItemDefinitionIndex
+
+template <typename T>
+static T ReadField(void* base, int32_t offset) {
+    return *reinterpret_cast<T*>(reinterpret_cast<uintptr_t>(base) + offset);
+}
+
+// Resolve slot and team of the player owning a pawn services component
+static bool GetOwner(void* services, int32_t* slot, int32_t* team) {
+    if (!services || s_offsetComponentPawn <= 0) return false;
+    void* pawn = ReadField<void*>(services, s_offsetComponentPawn);
+    if (!pawn) return false;
+
+    *team = s_offsetTeamNum > 0 ? ReadField<uint8_t>(pawn, s_offsetTeamNum) : -1;
+    *slot = -1;
+    if (s_offsetPawnController > 0) {
+        uint32_t handle = ReadField<uint32_t>(pawn, s_offsetPawnController);
+        if (handle != GS_INVALID_HANDLE) {
+            *slot = static_cast<int32_t>(handle & 0x7FFF) - 1;
+        }
+    }
+    return true;
+}
+
+static int32_t ItemIdFromEconItem(void* econItem) {
+    if (!econItem || s_offsetItemDefIndex <= 0) return GS_ITEM_INVALID;
+    return WeaponRegistry_FindByDefIndex(ReadField<uint16_t>(econItem, s_offsetItemDefIndex));
+}
+
+static int32_t ItemIdFromWeapon(void* weapon) {
+    if (!weapon || s_offsetAttributeManager <= 0 || s_offsetContainerItem <= 0) return GS_ITEM_INVALID;
+    void* econItem = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(weapon) +
+                                             s_offsetAttributeManager + s_offsetContainerItem);
+    return ItemIdFromEconItem(econItem);
+}
+
+static bool DetourCanUse(void* weaponServices, void* weapon) {
+    if (s_active && s_bypassDepth == 0) {
+        int32_t slot, team;
+        if (GetOwner(weaponServices, &slot, &team) &&
+            IsDenied(slot, team, ItemIdFromWeapon(weapon), GS_ACQUIRE_USE)) {
+            return false;
+        }
+    }
+    return s_pOriginalCanUse(weaponServices, weapon);
+}
+
+static int DetourCanAcquire(void* itemServices, void* econItem, int method, void* unk) {
+    if (s_active && s_bypassDepth == 0) {
+        int32_t slot, team;
+        if (GetOwner(itemServices, &slot, &team) &&
+            IsDenied(slot, team, ItemIdFromEconItem(econItem), method)) {
+            return kAcquireNotAllowedByProhibition;
+        }
+    }
+    return s_pOriginalCanAcquire(itemServices, econItem, method, unk);
+}
+
+static bool PrepareDetour(const char* name, void** original, void* detour) {
+    void* addr = g_gameConfig.ResolveSignature(name);
+    if (!addr) {
+        printf("[GoStrike] ItemRules: %s signature not found\n", name);
+        return false;
+    }
+
+    *original = addr;
+    int rv = funchook_prepare(s_pItemHooks, original, detour);
+    if (rv != 0) {
+        printf("[GoStrike] ItemRules: funchook_prepare(%s) failed: %s\n",
+               name, funchook_error_message(s_pItemHooks));
+        *original = nullptr;
+        return false;
+    }
+    return true;
+}
+#endif
+
+void ItemRules_Initialize() {
+    ItemRules_Clear();
+
+#ifndef USE_STUB_SDK
+    s_offsetComponentPawn = schema::GetOffset("CPlayerPawnComponent", "m_pPawn").offset;
+    if (s_offsetComponentPawn <= 0) {
+        // Older schema: the pawn is the chained entity
+        s_offsetComponentPawn = schema::GetOffset("CPlayerPawnComponent", "__m_pChainEntity").offset;
+    }
+    s_offsetPawnController = schema::GetOffset("CBasePlayerPawn", "m_hController").offset;
+    s_offsetTeamNum = schema::GetOffset("CBaseEntity", "m_iTeamNum").offset;
+    s_offsetAttributeManager = schema::GetOffset("CEconEntity", "m_AttributeManager").offset;
+    s_offsetContainerItem = schema::GetOffset("CAttributeContainer", "m_Item").offset;
+    s_offsetItemDefIndex = schema::GetOffset("CEconItemView", "m_iItemDefinitionIndex").offset;
+
+    s_pItemHooks = funchook_create();
+    if (!s_pItemHooks) {
+        printf("[GoStrike] ItemRules: funchook_create() failed\n");
+        return;
+    }
+
+    int prepared = 0;
+    prepared += PrepareDetour("CCSPlayer_WeaponServices_CanUse",
+                              (void**)&s_pOriginalCanUse, (void*)&DetourCanUse);
+    prepared += PrepareDetour("CCSPlayer_ItemServices_CanAcquire",
+                              (void**)&s_pOriginalCanAcquire, (void*)&DetourCanAcquire);
+
+    if (prepared == 0 || funchook_install(s_pItemHooks, 0) != 0) {
+        if (prepared > 0) {
+            printf("[GoStrike] ItemRules: funchook_install() failed: %s\n",
+                   funchook_error_message(s_pItemHooks));
+        }
+        funchook_destroy(s_pItemHooks);
+        s_pItemHooks = nullptr;
+        s_pOriginalCanUse = nullptr;
+        s_pOriginalCanAcquire = nullptr;
+        return;
+    }
+
+    printf("[GoStrike] ItemRules: hooks installed (canUse=%p, canAcquire=%p)\n",
+           (void*)s_pOriginalCanUse, (void*)s_pOriginalCanAcquire);
+#else
+    printf("[GoStrike] ItemRules: stub mode, item restrictions disabled\n");
+    (void)IsDenied;
+#endif
+}
+
+void ItemRules_Shutdown() {
+#ifndef USE_STUB_SDK
+    if (s_pItemHooks) {
+        funchook_uninstall(s_pItemHooks, 0);
+        funchook_destroy(s_pItemHooks);
+        s_pItemHooks = nullptr;
+        s_pOriginalCanUse = nullptr;
+        s_pOriginalCanAcquire = nullptr;
+        printf("[GoStrike] ItemRules: hooks removed\n");
+    }
+#endif
+    ItemRules_Clear();
+}
+
+void ItemRules_Set(int32_t rule, int32_t target, const int32_t* itemIds, int32_t count, bool enable) {
+    if (!itemIds || count <= 0) return;
+
+    ItemBits* bits = nullptr;
+    switch (rule) {
+    case GS_ITEM_RULE_TEAM_DENY:
+        if (target >= 0 && target < kMaxTeams) bits = &s_teamDeny[target];
+        break;
+    case GS_ITEM_RULE_SLOT_DENY:
+        if (target >= 0 && target < kMaxSlots) bits = &s_slotDeny[target];
+        break;
+    case GS_ITEM_RULE_ESCALATE:
+        if (target >= 0 && target < kMaxTeams) bits = &s_teamEscalate[target];
+        break;
+    default:
+        break;
+    }
+    if (!bits) return;
+
+    for (int32_t i = 0; i < count; i++) {
+        if (itemIds[i] >= 0 && itemIds[i] < kMaxItems) {
+            bits->Set(itemIds[i], enable);
+        }
+    }
+    RecomputeActive();
+}
+
+void ItemRules_SetLimit(int32_t team, int32_t itemId, int32_t limit) {
+    if (team < 0 || team >= kMaxTeams || itemId < 0 || itemId >= kMaxItems) return;
+    s_teamLimit[team][itemId] = limit < 0 ? -1 : limit;
+    RecomputeActive();
+}
+
+void ItemRules_SetCount(int32_t team, int32_t itemId, int32_t count) {
+    if (team < 0 || team >= kMaxTeams || itemId < 0 || itemId >= kMaxItems) return;
+    s_teamCount[team][itemId] = count;
+}
+
+void ItemRules_Clear() {
+    memset(s_teamDeny, 0, sizeof(s_teamDeny));
+    memset(s_teamEscalate, 0, sizeof(s_teamEscalate));
+    memset(s_slotDeny, 0, sizeof(s_slotDeny));
+    memset(s_teamCount, 0, sizeof(s_teamCount));
+    for (int t = 0; t < kMaxTeams; t++) {
+        for (int i = 0; i < kMaxItems; i++) {
+            s_teamLimit[t][i] = -1;
+        }
+    }
+    s_active = false;
+}
+
+void ItemRules_ClearSlot(int32_t slot) {
+    if (slot < 0 || slot >= kMaxSlots) return;
+    if (!s_slotDeny[slot].Any()) return;
+    memset(&s_slotDeny[slot], 0, sizeof(s_slotDeny[slot]));
+    RecomputeActive();
+}
+
+void ItemRules_BeginBypass() {
+    s_bypassDepth++;
+}
+
+void ItemRules_EndBypass() {
+    if (s_bypassDepth > 0) s_bypassDepth--;
+}
+
+} // namespace gostrike
@@ -0,0 +1,40 @@
+// item_rules.h - Weapon pickup/acquire restrictions
+// Detours CCSPlayer_WeaponServices_CanUse and CCSPlayer_ItemServices_CanAcquire
+// and decides natively from per-team/per-slot tables maintained by Go. Only
+// items marked for escalation call into Go.
+
+#ifndef GOSTRIKE_ITEM_RULES_H
+#define GOSTRIKE_ITEM_RULES_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Install the CanUse/CanAcquire detours
+void ItemRules_Initialize();
+
+// Remove the detours and clear all rules
+void ItemRules_Shutdown();
+
+// Set or clear a rule bit for each item ID.
+// rule: gs_item_rule_t; target: team for TEAM_DENY/ESCALATE, slot for SLOT_DENY
+void ItemRules_Set(int32_t rule, int32_t target, const int32_t* itemIds, int32_t count, bool enable);
+
+// Per-team item limit (-1 = unlimited) and the current holder count kept by Go
+void ItemRules_SetLimit(int32_t team, int32_t itemId, int32_t limit);
+void ItemRules_SetCount(int32_t team, int32_t itemId, int32_t count);
+
+// Drop every rule, limit and count
+void ItemRules_Clear();
+
+// Drop per-slot rules (called on disconnect)
+void ItemRules_ClearSlot(int32_t slot);
+
+// While a bypass is active (plugin-initiated gives) rules are not applied
+void ItemRules_BeginBypass();
+void ItemRules_EndBypass();
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_ITEM_RULES_H
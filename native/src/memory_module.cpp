@@ -7,9 +7,14 @@
 #include <cstring>
 #include <cstdio>
 #include <algorithm>
+#include <utility>
 #include <dlfcn.h>
 #include <link.h>
 #include <elf.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace gostrike {
 
@@ -22,7 +27,9 @@ struct ModuleSearchCtx {
     uint8_t* base;
     size_t size;
     char path[512];
+    uintptr_t loadBias;
     bool found;
+    std::vector<Module::Segment>* segments;
 };
 
 static int DlIterateCallback(struct dl_phdr_info* info, size_t /*size*/, void* data) {
@@ -51,6 +58,7 @@ static int DlIterateCallback(struct dl_phdr_info* info, size_t /*size*/, void* d
     uintptr_t minAddr = UINTPTR_MAX;
     uintptr_t maxAddr = 0;
 
+    ctx->segments->clear();
     for (int i = 0; i < info->dlpi_phnum; i++) {
         const auto& phdr = info->dlpi_phdr[i];
         if (phdr.p_type == PT_LOAD) {
@@ -58,12 +66,15 @@ static int DlIterateCallback(struct dl_phdr_info* info, size_t /*size*/, void* d
             uintptr_t segEnd = segStart + phdr.p_memsz;
             if (segStart < minAddr) minAddr = segStart;
             if (segEnd > maxAddr) maxAddr = segEnd;
+            ctx->segments->push_back({reinterpret_cast<uint8_t*>(segStart), phdr.p_memsz,
+                                      (phdr.p_flags & PF_X) != 0, (phdr.p_flags & PF_W) != 0});
         }
     }
 
     if (minAddr < maxAddr) {
         ctx->base = reinterpret_cast<uint8_t*>(minAddr);
         ctx->size = maxAddr - minAddr;
+        ctx->loadBias = info->dlpi_addr;
         strncpy(ctx->path, modulePath, sizeof(ctx->path) - 1);
         ctx->path[sizeof(ctx->path) - 1] = '\0';
         ctx->found = true;
@@ -76,9 +87,11 @@ static int DlIterateCallback(struct dl_phdr_info* info, size_t /*size*/, void* d
 bool Module::Initialize(const char* moduleName) {
     if (!moduleName) return false;
 
+    std::vector<Segment> segments;
     ModuleSearchCtx ctx = {};
     ctx.targetName = moduleName;
     ctx.found = false;
+    ctx.segments = &segments;
 
     dl_iterate_phdr(DlIterateCallback, &ctx);
 
@@ -91,15 +104,80 @@ bool Module::Initialize(const char* moduleName) {
     m_path = ctx.path;
     m_base = ctx.base;
     m_size = ctx.size;
+    m_segments = std::move(segments);
+    m_loadBias = ctx.loadBias;
 
     // Open handle for dlsym lookups
     m_dlHandle = dlopen(ctx.path, RTLD_NOW | RTLD_NOLOAD);
 
     printf("[GoStrike] Module found: %s at %p (size: %zu, path: %s)\n",
            moduleName, m_base, m_size, m_path.c_str());
+
+    LoadSymbolTable();
     return true;
 }
 
+// ============================================================
+// ELF Symbol Index
+// ============================================================
+
+void Module::LoadSymbolTable() {
+    m_symbols.clear();
+
+    int fd = open(m_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        printf("[GoStrike] Module %s: cannot open %s for symbol indexing\n", m_name.c_str(), m_path.c_str());
+        return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Elf64_Ehdr))) {
+        close(fd);
+        return;
+    }
+    size_t fileSize = static_cast<size_t>(st.st_size);
+    void* map = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return;
+
+    const auto* file = static_cast<const uint8_t*>(map);
+    const auto* ehdr = reinterpret_cast<const Elf64_Ehdr*>(file);
+    bool valid = memcmp(ehdr->e_ident, ELFMAG, SELFMAG) == 0 && ehdr->e_ident[EI_CLASS] == ELFCLASS64 &&
+                 ehdr->e_shentsize == sizeof(Elf64_Shdr) &&
+                 ehdr->e_shoff + static_cast<size_t>(ehdr->e_shnum) * sizeof(Elf64_Shdr) <= fileSize;
+
+    if (valid) {
+        const auto* shdrs = reinterpret_cast<const Elf64_Shdr*>(file + ehdr->e_shoff);
+        for (int i = 0; i < ehdr->e_shnum; i++) {
+            const Elf64_Shdr& sec = shdrs[i];
+            if (sec.sh_type != SHT_SYMTAB && sec.sh_type != SHT_DYNSYM) continue;
+            if (sec.sh_link >= ehdr->e_shnum || sec.sh_entsize != sizeof(Elf64_Sym)) continue;
+
+            const Elf64_Shdr& strSec = shdrs[sec.sh_link];
+            if (sec.sh_offset + sec.sh_size > fileSize || strSec.sh_offset + strSec.sh_size > fileSize) continue;
+
+            const auto* syms = reinterpret_cast<const Elf64_Sym*>(file + sec.sh_offset);
+            const char* strtab = reinterpret_cast<const char*>(file + strSec.sh_offset);
+            size_t count = sec.sh_size / sizeof(Elf64_Sym);
+            m_symbols.reserve(m_symbols.size() + count);
+
+            for (size_t s = 0; s < count; s++) {
+                const Elf64_Sym& sym = syms[s];
+                int type = ELF64_ST_TYPE(sym.st_info);
+                if (sym.st_shndx == SHN_UNDEF || sym.st_value == 0 || sym.st_name >= strSec.sh_size) continue;
+                if (type != STT_FUNC && type != STT_OBJECT) continue;
+
+                const char* name = strtab + sym.st_name;
+                if (name[0] == '\0') continue;
+                // .dynsym and .symtab overlap; the first definition wins
+                m_symbols.emplace(name, m_loadBias + sym.st_value);
+            }
+        }
+    }
+
+    munmap(map, fileSize);
+    printf("[GoStrike] Module %s: indexed %zu ELF symbols\n", m_name.c_str(), m_symbols.size());
+}
+
 // ============================================================
 // Signature Parsing
 // ============================================================
@@ -179,6 +257,29 @@ void* Module::FindSignature(const char* signature) const {
     return nullptr;
 }
 
+bool Module::MatchesSignature(const void* addr, const char* signature) const {
+    if (!m_base || !addr || !signature) return false;
+
+    auto sigBytes = ParseSignature(signature);
+    auto* p = static_cast<const uint8_t*>(addr);
+    if (sigBytes.empty() || p < m_base || p + sigBytes.size() > m_base + m_size) return false;
+
+    for (size_t i = 0; i < sigBytes.size(); i++) {
+        if (sigBytes[i] != -1 && p[i] != static_cast<uint8_t>(sigBytes[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Module::IsCode(const void* addr) const {
+    auto* p = static_cast<const uint8_t*>(addr);
+    for (const auto& seg : m_segments) {
+        if (seg.executable && p >= seg.start && p < seg.start + seg.size) return true;
+    }
+    return false;
+}
+
 // ============================================================
 // Symbol Lookup
 // ============================================================
@@ -186,7 +287,13 @@ void* Module::FindSignature(const char* signature) const {
 void* Module::FindSymbol(const char* symbolName) const {
     if (!symbolName) return nullptr;
 
-    // Try dlsym with the module handle first
+    // Local and hidden symbols are only reachable through the ELF index
+    auto it = m_symbols.find(symbolName);
+    if (it != m_symbols.end()) {
+        return reinterpret_cast<void*>(it->second);
+    }
+
+    // Try dlsym with the module handle
     if (m_dlHandle) {
         void* addr = dlsym(m_dlHandle, symbolName);
         if (addr) return addr;
@@ -8,12 +8,21 @@
 #include <cstdint>
 #include <cstddef>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace gostrike {
 
 class Module {
 public:
+    // A loaded PT_LOAD segment
+    struct Segment {
+        uint8_t* start;
+        size_t size;
+        bool executable;
+        bool writable;
+    };
+
     Module() = default;
 
     // Initialize by finding a loaded module by name (e.g. "libserver.so")
@@ -23,9 +32,21 @@ public:
     // Signature format: "55 48 89 E5 ?? 48 89" where ?? is wildcard
     void* FindSignature(const char* signature) const;
 
-    // Find an exported symbol by name
+    // Find a symbol by name: the module's .symtab/.dynsym index first (covers
+    // local and hidden symbols), then dlsym
     void* FindSymbol(const char* symbolName) const;
 
+    // Number of indexed ELF symbols (0 if the module file could not be read)
+    size_t GetSymbolCount() const { return m_symbols.size(); }
+
+    // Check whether the bytes at addr (inside this module) match a signature
+    bool MatchesSignature(const void* addr, const char* signature) const;
+
+    // Check whether addr lies in an executable segment of this module
+    bool IsCode(const void* addr) const;
+
+    const std::vector<Segment>& GetSegments() const { return m_segments; }
+
     bool IsInitialized() const { return m_base != nullptr; }
     const char* GetName() const { return m_name.c_str(); }
     const char* GetPath() const { return m_path.c_str(); }
@@ -36,11 +57,17 @@ private:
     // Parse hex signature string into byte vector (-1 = wildcard)
     static std::vector<int16_t> ParseSignature(const char* sig);
 
+    // Map the module file and index its .symtab and .dynsym
+    void LoadSymbolTable();
+
     std::string m_name;
     std::string m_path;
     uint8_t* m_base = nullptr;
     size_t m_size = 0;
     void* m_dlHandle = nullptr;
+    std::vector<Segment> m_segments;
+    uintptr_t m_loadBias = 0;                            // dlpi_addr
+    std::unordered_map<std::string, uintptr_t> m_symbols; // name -> rebased address
 };
 
 // Pre-initialized well-known modules
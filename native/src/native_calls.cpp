@@ -0,0 +1,139 @@
+// native_calls.cpp - Generic native function invocation
+// Each definition precomputes its register assignment, so a call is a table
+// lookup, an unpack of the argument buffer into a register file and a single
+// indirect call. Virtual functions are looked up in `this`'s vtable per call.
+
+#include "native_calls.h"
+#include "gameconfig.h"
+#include "register_args.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace gostrike {
+
+#ifndef USE_STUB_SDK
+struct CallDef {
+    std::string name;
+    int32_t vtableIndex;  // >= 0 for virtual calls
+    void* fn;             // Direct calls
+    int32_t retType;
+    int32_t argc;
+    int32_t argTypes[GS_HOOK_MAX_ARGS];
+    int8_t argReg[GS_HOOK_MAX_ARGS];
+};
+
+static std::vector<CallDef> s_calls;
+
+static bool SameDefinition(const CallDef& c, const char* name, int32_t vtableIndex, int32_t retType,
+                           const int32_t* argTypes, int32_t argc) {
+    if (c.name != (name ? name : "") || c.vtableIndex != vtableIndex ||
+        c.retType != retType || c.argc != argc) {
+        return false;
+    }
+    for (int32_t a = 0; a < argc; a++) {
+        if (c.argTypes[a] != argTypes[a]) return false;
+    }
+    return true;
+}
+#endif
+
+int32_t NativeCalls_Define(const char* name, int32_t vtableIndex, int32_t retType,
+                           const int32_t* argTypes, int32_t argc) {
+#ifndef USE_STUB_SDK
+    if (argc < 0 || argc > GS_HOOK_MAX_ARGS || (argc > 0 && !argTypes)) return -1;
+    // Vectors are returned in XMM0:XMM1 and are not supported as return values
+    if (retType < GS_HOOK_TYPE_VOID || retType >= GS_HOOK_TYPE_VECTOR) return -1;
+    if (vtableIndex < 0 && (!name || name[0] == '\0')) return -1;
+
+    // Same description -> same ID (plugins may define the same call independently)
+    for (size_t i = 0; i < s_calls.size(); i++) {
+        if (SameDefinition(s_calls[i], name, vtableIndex, retType, argTypes, argc)) {
+            return static_cast<int32_t>(i);
+        }
+    }
+
+    CallDef def;
+    def.name = name ? name : "";
+    def.vtableIndex = vtableIndex;
+    def.fn = nullptr;
+    def.retType = retType;
+    def.argc = argc;
+    for (int32_t a = 0; a < argc; a++) {
+        def.argTypes[a] = argTypes[a];
+    }
+    if (!AssignArgRegisters(argTypes, argc, def.argReg)) {
+        printf("[GoStrike] NativeCalls: %s: invalid argument types or arguments do not fit in registers\n",
+               def.name.c_str());
+        return -1;
+    }
+
+    if (def.vtableIndex < 0) {
+        // Gamedata signature first, then a gamedata vtable offset
+        def.fn = g_gameConfig.ResolveSignature(name);
+        if (!def.fn) def.vtableIndex = g_gameConfig.GetOffset(name);
+        if (!def.fn && def.vtableIndex < 0) {
+            printf("[GoStrike] NativeCalls: %s not found in gamedata\n", name);
+            return -1;
+        }
+    }
+    if (def.vtableIndex >= 0 && (argc == 0 || argTypes[0] != GS_HOOK_TYPE_POINTER)) {
+        printf("[GoStrike] NativeCalls: %s: virtual calls need `this` as the first POINTER argument\n",
+               def.name.c_str());
+        return -1;
+    }
+
+    s_calls.push_back(def);
+    return static_cast<int32_t>(s_calls.size() - 1);
+#else
+    (void)name;
+    (void)vtableIndex;
+    (void)retType;
+    (void)argTypes;
+    (void)argc;
+    return -1;
+#endif
+}
+
+bool NativeCalls_Invoke(int32_t id, const uint64_t* args, const gs_vector3_t* vectors, uint64_t* ret) {
+#ifndef USE_STUB_SDK
+    if (id < 0 || id >= static_cast<int32_t>(s_calls.size())) return false;
+    const CallDef& c = s_calls[id];
+    if (c.argc > 0 && !args) return false;
+
+    RegFile regs = {};
+    for (int32_t a = 0; a < c.argc; a++) {
+        uint64_t value = args[a];
+        if (c.argTypes[a] == GS_HOOK_TYPE_VECTOR) {
+            value = vectors ? reinterpret_cast<uint64_t>(&vectors[value]) : 0;
+        }
+        UnpackRegArg(c.argTypes[a], value, regs, c.argReg[a]);
+    }
+
+    void* fn = c.fn;
+    if (c.vtableIndex >= 0) {
+        void* self = reinterpret_cast<void*>(regs.i[0]);
+        if (!self) return false;
+        fn = (*reinterpret_cast<void***>(self))[c.vtableIndex];
+    }
+
+    uint64_t result = CallWithRegisters(fn, c.retType, regs);
+    if (ret) *ret = result;
+    return true;
+#else
+    (void)id;
+    (void)args;
+    (void)vectors;
+    (void)ret;
+    return false;
+#endif
+}
+
+void NativeCalls_Shutdown() {
+#ifndef USE_STUB_SDK
+    s_calls.clear();
+#endif
+}
+
+} // namespace gostrike
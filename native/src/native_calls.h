@@ -0,0 +1,31 @@
+// native_calls.h - Generic native function invocation
+// Go describes a function once (gamedata signature, gamedata vtable offset or
+// raw vtable index, plus its argument/return types) and gets a call ID; later
+// calls pass arguments in a packed buffer and dispatch through one register
+// file call (see register_args.h).
+
+#ifndef GOSTRIKE_NATIVE_CALLS_H
+#define GOSTRIKE_NATIVE_CALLS_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Describe a callable function. name: gamedata signature or offset entry (may be
+// NULL when vtableIndex >= 0). A virtual call takes `this` as its first POINTER
+// argument. Returns the call ID, or -1 if unresolvable or unsupported.
+int32_t NativeCalls_Define(const char* name, int32_t vtableIndex, int32_t retType,
+                           const int32_t* argTypes, int32_t argc);
+
+// Invoke a defined function (game thread only). args: one normalized slot per
+// declared argument; VECTOR slots index into vectors. ret may be NULL.
+// Returns false for an unknown ID or a null `this`.
+bool NativeCalls_Invoke(int32_t id, const uint64_t* args, const gs_vector3_t* vectors, uint64_t* ret);
+
+// Drop every definition
+void NativeCalls_Shutdown();
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_NATIVE_CALLS_H
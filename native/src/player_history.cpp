@@ -0,0 +1,208 @@
+// player_history.cpp - Per-player state history ring buffers
+//
+// Each slot owns one column block per field, so a query touches only the
+// fields it interpolates and a recorder write is a handful of scalar stores.
+// Samples are only interpolated across gaps of at most kMaxLerpGap ticks.
+// Past the last sample of a run, whether the newest one or one followed by a
+// longer gap (death, respawn), it is returned for up to one tick and no sample
+// exists after that.
+
+#include "player_history.h"
+#include "player_manager.h"
+#include "schema.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace gostrike {
+
+static constexpr int kMaxSlots = 64;
+static constexpr int kTicks = GS_HISTORY_TICKS;
+static constexpr int kMaxLerpGap = 4;
+
+struct SlotHistory {
+    int32_t tick[kTicks];
+    float originX[kTicks], originY[kTicks], originZ[kTicks];
+    float pitch[kTicks], yaw[kTicks], roll[kTicks];
+    float velX[kTicks], velY[kTicks], velZ[kTicks];
+    uint32_t flags[kTicks];
+    int32_t head;   // Next write position
+    int32_t count;  // Valid samples (<= kTicks)
+};
+
+static SlotHistory s_history[kMaxSlots];
+static int32_t s_latestTick = -1;
+
+#ifndef USE_STUB_SDK
+static int32_t s_offsetLifeState = 0;   // CBaseEntity::m_lifeState
+static int32_t s_offsetBody = 0;        // CBaseEntity::m_CBodyComponent
+static int32_t s_offsetSceneNode = 0;   // CBodyComponent::m_pSceneNode
+static int32_t s_offsetAbsOrigin = 0;   // CGameSceneNode::m_vecAbsOrigin
+static int32_t s_offsetEyeAngles = 0;   // CCSPlayerPawn::m_angEyeAngles
+static int32_t s_offsetVelocity = 0;    // CBaseEntity::m_vecAbsVelocity
+static int32_t s_offsetFlags = 0;       // CBaseEntity::m_fFlags
+
+template <typename T>
+static T* FieldPtr(void* base, int32_t offset) {
+    return reinterpret_cast<T*>(reinterpret_cast<uintptr_t>(base) + offset);
+}
+#endif
+
+// Physical ring index of the i-th oldest sample
+static inline int RingIndex(const SlotHistory& h, int i) {
+    return (h.head - h.count + i + kTicks) % kTicks;
+}
+
+static float LerpAngle(float a, float b, float t) {
+    float d = std::fmod(b - a + 540.0f, 360.0f) - 180.0f;
+    return a + d * t;
+}
+
+void PlayerHistory_Initialize() {
+    memset(s_history, 0, sizeof(s_history));
+    s_latestTick = -1;
+
+#ifndef USE_STUB_SDK
+    s_offsetLifeState = schema::GetOffset("CBaseEntity", "m_lifeState").offset;
+    s_offsetBody = schema::GetOffset("CBaseEntity", "m_CBodyComponent").offset;
+    s_offsetSceneNode = schema::GetOffset("CBodyComponent", "m_pSceneNode").offset;
+    s_offsetAbsOrigin = schema::GetOffset("CGameSceneNode", "m_vecAbsOrigin").offset;
+    s_offsetEyeAngles = schema::GetOffset("CCSPlayerPawn", "m_angEyeAngles").offset;
+    s_offsetVelocity = schema::GetOffset("CBaseEntity", "m_vecAbsVelocity").offset;
+    s_offsetFlags = schema::GetOffset("CBaseEntity", "m_fFlags").offset;
+#endif
+}
+
+void PlayerHistory_Record(int32_t tick) {
+    // The tick counter restarts on map change; old history is meaningless then
+    if (tick < s_latestTick) {
+        for (auto& h : s_history) h.count = 0;
+    }
+
+#ifndef USE_STUB_SDK
+    if (s_offsetBody <= 0 || s_offsetSceneNode <= 0 || s_offsetAbsOrigin <= 0) return;
+
+    for (int slot = 0; slot < kMaxSlots; slot++) {
+        void* pawn = PlayerManager_GetPawn(slot);
+        if (!pawn) continue;
+        if (s_offsetLifeState > 0 && *FieldPtr<uint8_t>(pawn, s_offsetLifeState) != 0) continue;
+
+        void* body = *FieldPtr<void*>(pawn, s_offsetBody);
+        void* node = body ? *FieldPtr<void*>(body, s_offsetSceneNode) : nullptr;
+        if (!node) continue;
+
+        gs_player_sample_t sample = {};
+        memcpy(&sample.origin, FieldPtr<float>(node, s_offsetAbsOrigin), sizeof(gs_vector3_t));
+        if (s_offsetEyeAngles > 0) {
+            memcpy(&sample.eye_angles, FieldPtr<float>(pawn, s_offsetEyeAngles), sizeof(gs_vector3_t));
+        }
+        if (s_offsetVelocity > 0) {
+            memcpy(&sample.velocity, FieldPtr<float>(pawn, s_offsetVelocity), sizeof(gs_vector3_t));
+        }
+        sample.flags = s_offsetFlags > 0 ? *FieldPtr<uint32_t>(pawn, s_offsetFlags) : 0;
+        PlayerHistory_RecordSample(slot, tick, &sample);
+    }
+#endif
+
+    s_latestTick = tick;
+}
+
+void PlayerHistory_RecordSample(int32_t slot, int32_t tick, const gs_player_sample_t* sample) {
+    if (slot < 0 || slot >= kMaxSlots || !sample) return;
+
+    SlotHistory& h = s_history[slot];
+    // One sample per tick (GameFrame can run more than once per tick)
+    if (h.count > 0 && h.tick[RingIndex(h, h.count - 1)] == tick) return;
+
+    int i = h.head;
+    h.tick[i] = tick;
+    h.originX[i] = sample->origin.x;
+    h.originY[i] = sample->origin.y;
+    h.originZ[i] = sample->origin.z;
+    h.pitch[i] = sample->eye_angles.x;
+    h.yaw[i] = sample->eye_angles.y;
+    h.roll[i] = sample->eye_angles.z;
+    h.velX[i] = sample->velocity.x;
+    h.velY[i] = sample->velocity.y;
+    h.velZ[i] = sample->velocity.z;
+    h.flags[i] = sample->flags;
+
+    h.head = (h.head + 1) % kTicks;
+    if (h.count < kTicks) h.count++;
+}
+
+static bool Sample(int32_t slot, float tick, gs_player_sample_t* out) {
+    out->slot = slot;
+    out->valid = false;
+    if (slot < 0 || slot >= kMaxSlots) return false;
+
+    const SlotHistory& h = s_history[slot];
+    if (h.count == 0) return false;
+
+    // Binary search for the newest sample at or before tick
+    int lo = 0, hi = h.count - 1, found = -1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (static_cast<float>(h.tick[RingIndex(h, mid)]) <= tick) {
+            found = mid;
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    if (found < 0) return false;
+
+    int a = RingIndex(h, found);
+    float t = 0.0f;
+    int b = a;
+    int32_t gap = 0;
+    if (found + 1 < h.count) {
+        gap = h.tick[RingIndex(h, found + 1)] - h.tick[a];
+    }
+    if (gap > 0 && gap <= kMaxLerpGap) {
+        b = RingIndex(h, found + 1);
+        t = (tick - static_cast<float>(h.tick[a])) / static_cast<float>(gap);
+    } else if (tick > static_cast<float>(h.tick[a]) + 1.0f) {
+        return false; // Newer than anything recorded, or inside a gap (dead)
+    }
+
+    out->origin.x = h.originX[a] + (h.originX[b] - h.originX[a]) * t;
+    out->origin.y = h.originY[a] + (h.originY[b] - h.originY[a]) * t;
+    out->origin.z = h.originZ[a] + (h.originZ[b] - h.originZ[a]) * t;
+    out->eye_angles.x = LerpAngle(h.pitch[a], h.pitch[b], t);
+    out->eye_angles.y = LerpAngle(h.yaw[a], h.yaw[b], t);
+    out->eye_angles.z = LerpAngle(h.roll[a], h.roll[b], t);
+    out->velocity.x = h.velX[a] + (h.velX[b] - h.velX[a]) * t;
+    out->velocity.y = h.velY[a] + (h.velY[b] - h.velY[a]) * t;
+    out->velocity.z = h.velZ[a] + (h.velZ[b] - h.velZ[a]) * t;
+    out->flags = h.flags[a];
+    out->valid = true;
+    return true;
+}
+
+int32_t PlayerHistory_Query(const int32_t* slots, int32_t count, float tick, gs_player_sample_t* out) {
+    if (!slots || !out || count <= 0) return 0;
+
+    int32_t valid = 0;
+    for (int32_t i = 0; i < count; i++) {
+        if (Sample(slots[i], tick, &out[i])) valid++;
+    }
+    return valid;
+}
+
+int32_t PlayerHistory_LatestTick() {
+    return s_latestTick;
+}
+
+void PlayerHistory_ClearSlot(int32_t slot) {
+    if (slot < 0 || slot >= kMaxSlots) return;
+    s_history[slot].head = 0;
+    s_history[slot].count = 0;
+}
+
+void PlayerHistory_Reset() {
+    for (int slot = 0; slot < kMaxSlots; slot++) PlayerHistory_ClearSlot(slot);
+    s_latestTick = -1;
+}
+
+} // namespace gostrike
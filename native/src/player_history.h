@@ -0,0 +1,39 @@
+// player_history.h - Per-player state history ring buffers
+// Every game frame, right after the player cache refresh, each live player's
+// origin, eye angles, velocity and flags are appended to a per-slot ring of
+// GS_HISTORY_TICKS entries (SoA). Queries interpolate between recorded ticks.
+
+#ifndef GOSTRIKE_PLAYER_HISTORY_H
+#define GOSTRIKE_PLAYER_HISTORY_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Resolve schema offsets (after schema init)
+void PlayerHistory_Initialize();
+
+// Record one sample per live player for this tick (game thread, once per frame)
+void PlayerHistory_Record(int32_t tick);
+
+// Append one slot's sample for a tick. Ticks must increase; a repeated tick is
+// ignored. sample->slot and sample->valid are not used.
+void PlayerHistory_RecordSample(int32_t slot, int32_t tick, const gs_player_sample_t* sample);
+
+// Interpolated state of many slots at a (fractional) tick.
+// Returns the number of valid samples written.
+int32_t PlayerHistory_Query(const int32_t* slots, int32_t count, float tick, gs_player_sample_t* out);
+
+// Newest recorded tick, or -1
+int32_t PlayerHistory_LatestTick();
+
+// Forget a slot's history (disconnect)
+void PlayerHistory_ClearSlot(int32_t slot);
+
+// Forget every slot's history (map end)
+void PlayerHistory_Reset();
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_PLAYER_HISTORY_H
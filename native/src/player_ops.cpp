@@ -0,0 +1,138 @@
+// player_ops.cpp - Batched player operations
+// Controller, pawn and m_pItemServices are resolved at most once per slot per
+// submission. Respawn and team changes can replace the pawn, so they drop the
+// cached pawn and the next op for that slot resolves it again.
+
+#include "player_ops.h"
+#include "game_functions.h"
+#include "player_manager.h"
+#include "schema.h"
+#include "weapon_registry.h"
+
+#include <cstdio>
+
+namespace gostrike {
+
+#ifndef USE_STUB_SDK
+static constexpr int kMaxSlots = 64;
+
+struct SlotEntities {
+    uint32_t stamp;           // Submission this entry belongs to
+    void* controller;
+    void* pawn;
+    void* itemServices;
+    bool pawnResolved;
+    bool itemServicesResolved;
+};
+
+static SlotEntities s_slots[kMaxSlots];
+static uint32_t s_submitStamp = 0;
+
+static SlotEntities& GetSlot(int32_t slot) {
+    SlotEntities& e = s_slots[slot];
+    if (e.stamp != s_submitStamp) {
+        e.stamp = s_submitStamp;
+        e.controller = PlayerManager_GetController(slot);
+        e.pawn = nullptr;
+        e.itemServices = nullptr;
+        e.pawnResolved = false;
+        e.itemServicesResolved = false;
+    }
+    return e;
+}
+
+static void* GetPawn(SlotEntities& e, int32_t slot) {
+    if (!e.pawnResolved) {
+        e.pawn = PlayerManager_GetPawn(slot);
+        e.pawnResolved = true;
+    }
+    return e.pawn;
+}
+
+static void* GetItemServices(SlotEntities& e, int32_t slot) {
+    if (!e.itemServicesResolved) {
+        e.itemServices = GameFunc_GetItemServices(GetPawn(e, slot));
+        e.itemServicesResolved = true;
+    }
+    return e.itemServices;
+}
+
+static void InvalidatePawn(SlotEntities& e) {
+    e.pawn = nullptr;
+    e.itemServices = nullptr;
+    e.pawnResolved = false;
+    e.itemServicesResolved = false;
+}
+
+static bool SetPawnInt(void* pawn, const schema::SchemaKey& key, int32_t value) {
+    if (!pawn || key.offset <= 0) return false;
+    *reinterpret_cast<int32_t*>(reinterpret_cast<uintptr_t>(pawn) + key.offset) = value;
+    if (key.networked) {
+        schema::QueueStateChanged(pawn, key.offset);
+    }
+    return true;
+}
+#endif
+
+int32_t PlayerOps_Submit(const gs_player_op_t* ops, int32_t count) {
+#ifndef USE_STUB_SDK
+    if (!ops || count <= 0) return 0;
+
+    // A new stamp lazily invalidates every cached slot from the previous submission
+    if (++s_submitStamp == 0) ++s_submitStamp;
+
+    auto healthKey = schema::GetOffset("CBaseEntity", "m_iHealth");
+    auto armorKey = schema::GetOffset("CCSPlayerPawn", "m_ArmorValue");
+
+    int32_t applied = 0;
+    for (int32_t i = 0; i < count; i++) {
+        const gs_player_op_t& op = ops[i];
+        if (op.slot < 0 || op.slot >= kMaxSlots) continue;
+
+        SlotEntities& e = GetSlot(op.slot);
+        if (!e.controller) continue;
+
+        bool ok = false;
+        switch (op.kind) {
+        case GS_PLAYER_OP_RESPAWN:
+            ok = GameFunc_RespawnController(e.controller);
+            InvalidatePawn(e);
+            break;
+        case GS_PLAYER_OP_TELEPORT:
+            ok = GameFunc_TeleportEntity(GetPawn(e, op.slot),
+                                         (op.flags & GS_PLAYER_OP_ORIGIN) ? &op.origin : nullptr,
+                                         (op.flags & GS_PLAYER_OP_ANGLES) ? &op.angles : nullptr,
+                                         (op.flags & GS_PLAYER_OP_VELOCITY) ? &op.velocity : nullptr);
+            break;
+        case GS_PLAYER_OP_SET_HEALTH:
+            ok = SetPawnInt(GetPawn(e, op.slot), healthKey, op.value);
+            break;
+        case GS_PLAYER_OP_SET_ARMOR:
+            ok = SetPawnInt(GetPawn(e, op.slot), armorKey, op.value);
+            break;
+        case GS_PLAYER_OP_STRIP:
+            ok = GameFunc_RemoveWeaponsServices(GetItemServices(e, op.slot));
+            break;
+        case GS_PLAYER_OP_GIVE_ITEM:
+            ok = GameFunc_GiveNamedItemServices(GetItemServices(e, op.slot),
+                                                op.item ? op.item : WeaponRegistry_GetClassname(op.value));
+            break;
+        case GS_PLAYER_OP_SET_TEAM:
+            ok = GameFunc_ChangeTeamController(e.controller, op.value);
+            InvalidatePawn(e);
+            break;
+        default:
+            printf("[GoStrike] PlayerOps: unknown op kind %d\n", op.kind);
+            break;
+        }
+        if (ok) applied++;
+    }
+    return applied;
+#else
+    (void)ops;
+    (void)count;
+    return 0;
+#endif
+}
+
+} // namespace gostrike
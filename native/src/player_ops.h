@@ -0,0 +1,19 @@
+// player_ops.h - Batched player operations
+// Executes a command buffer of respawn/teleport/health/armor/strip/give/team
+// operations in one native call, resolving each slot's entities once.
+
+#ifndef GOSTRIKE_PLAYER_OPS_H
+#define GOSTRIKE_PLAYER_OPS_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Execute ops in order (game thread only). Returns the number of ops applied;
+// ops for empty slots or with missing gamedata are skipped.
+int32_t PlayerOps_Submit(const gs_player_op_t* ops, int32_t count);
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_PLAYER_OPS_H
@@ -0,0 +1,158 @@
+// property_watch.cpp - Dirty-tracked entity property watchers
+//
+// Each watch owns one 16-byte slot in two parallel buffers (previous and
+// current frame). A frame gathers every watched field into the current buffer,
+// then one memcmp over both buffers decides whether anything changed at all;
+// only then are the slots compared pairwise (two 64-bit compares each) to build
+// the change batch. Inactive slots are kept zeroed in both buffers so they
+// never compare unequal.
+
+#include "property_watch.h"
+#include "entity_system.h"
+#include "go_bridge.h"
+#include "schema.h"
+
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace gostrike {
+
+struct Watch {
+    uint32_t handle;
+    int32_t offset;
+    int32_t size;
+    bool active;
+};
+
+struct alignas(16) WatchValue {
+    uint64_t w[2];
+};
+static_assert(sizeof(WatchValue) == GS_WATCH_VALUE_SIZE, "watch value slot size");
+
+static std::vector<Watch> s_watches;
+static std::vector<WatchValue> s_prev;
+static std::vector<WatchValue> s_cur;
+static std::vector<int32_t> s_freeIds;
+static int32_t s_activeCount = 0;
+static std::vector<gs_watch_change_t> s_changes;
+
+// Copy a watched field into a slot. Returns false if the entity is gone.
+static bool ReadValue(const Watch& w, WatchValue* out) {
+    void* entity = EntitySystem_GetEntityByHandle(w.handle);
+    if (!entity) return false;
+    out->w[0] = out->w[1] = 0;
+    memcpy(out, reinterpret_cast<uint8_t*>(entity) + w.offset, w.size);
+    return true;
+}
+
+static void ReleaseSlot(int32_t id) {
+    s_watches[id].active = false;
+    s_prev[id] = s_cur[id] = WatchValue{};
+    s_freeIds.push_back(id);
+    s_activeCount--;
+}
+
+static void PushChange(int32_t id, uint32_t flags, const WatchValue& oldValue, const WatchValue& newValue) {
+    gs_watch_change_t change;
+    change.watch_id = id;
+    change.flags = flags;
+    memcpy(change.old_value, &oldValue, sizeof(change.old_value));
+    memcpy(change.new_value, &newValue, sizeof(change.new_value));
+    s_changes.push_back(change);
+}
+
+int32_t PropertyWatch_Add(uint32_t entityHandle, const char* className, const char* fieldName, int32_t size) {
+    if (!className || !fieldName || size <= 0 || size > GS_WATCH_VALUE_SIZE) return -1;
+
+    int32_t offset = schema::GetOffset(className, fieldName).offset;
+    if (offset <= 0) {
+        printf("[GoStrike] PropertyWatch: unknown field %s::%s\n", className, fieldName);
+        return -1;
+    }
+
+    Watch w = {entityHandle, offset, size, true};
+    WatchValue initial;
+    if (!ReadValue(w, &initial)) return -1;
+
+    int32_t id;
+    if (!s_freeIds.empty()) {
+        id = s_freeIds.back();
+        s_freeIds.pop_back();
+        s_watches[id] = w;
+    } else {
+        id = static_cast<int32_t>(s_watches.size());
+        s_watches.push_back(w);
+        s_prev.emplace_back();
+        s_cur.emplace_back();
+    }
+    // Start from the current value so the first frame reports nothing
+    s_prev[id] = s_cur[id] = initial;
+    s_activeCount++;
+    return id;
+}
+
+void PropertyWatch_Remove(int32_t id) {
+    if (id < 0 || id >= static_cast<int32_t>(s_watches.size()) || !s_watches[id].active) return;
+    ReleaseSlot(id);
+}
+
+void PropertyWatch_OnGameFrame() {
+    if (s_activeCount == 0) return;
+
+    // Gather
+    size_t n = s_watches.size();
+    for (size_t i = 0; i < n; i++) {
+        if (!s_watches[i].active) continue;
+        if (!ReadValue(s_watches[i], &s_cur[i])) {
+            PushChange(static_cast<int32_t>(i), GS_WATCH_REMOVED, s_prev[i], WatchValue{});
+            ReleaseSlot(static_cast<int32_t>(i));
+        }
+    }
+
+    // Diff: one bulk compare, then per-slot only if something differs
+    if (memcmp(s_cur.data(), s_prev.data(), n * sizeof(WatchValue)) != 0) {
+        for (size_t i = 0; i < n; i++) {
+            const WatchValue& a = s_prev[i];
+            const WatchValue& b = s_cur[i];
+            if (((a.w[0] ^ b.w[0]) | (a.w[1] ^ b.w[1])) != 0) {
+                PushChange(static_cast<int32_t>(i), 0, a, b);
+            }
+        }
+        s_prev.swap(s_cur);
+    }
+
+    if (s_changes.empty()) return;
+
+    // Swap out first: handlers may add or remove watches
+    std::vector<gs_watch_change_t> changes;
+    changes.swap(s_changes);
+    GoBridge_OnPropertyChanges(changes.data(), static_cast<int32_t>(changes.size()));
+}
+
+void PropertyWatch_OnMapEnd() {
+    if (s_activeCount == 0) return;
+
+    size_t n = s_watches.size();
+    for (size_t i = 0; i < n; i++) {
+        if (!s_watches[i].active) continue;
+        PushChange(static_cast<int32_t>(i), GS_WATCH_REMOVED, s_prev[i], WatchValue{});
+        ReleaseSlot(static_cast<int32_t>(i));
+    }
+
+    std::vector<gs_watch_change_t> changes;
+    changes.swap(s_changes);
+    GoBridge_OnPropertyChanges(changes.data(), static_cast<int32_t>(changes.size()));
+}
+
+void PropertyWatch_Shutdown() {
+    s_watches.clear();
+    s_prev.clear();
+    s_cur.clear();
+    s_freeIds.clear();
+    s_changes.clear();
+    s_activeCount = 0;
+}
+
+} // namespace gostrike
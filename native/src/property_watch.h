@@ -0,0 +1,33 @@
+// property_watch.h - Dirty-tracked entity property watchers
+// Watched fields are copied into a compact snapshot buffer once per frame and
+// compared against the previous frame's buffer; only changed watches are
+// delivered to Go, in one batch.
+
+#ifndef GOSTRIKE_PROPERTY_WATCH_H
+#define GOSTRIKE_PROPERTY_WATCH_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Watch size bytes of className::fieldName on the entity behind handle.
+// Returns the watch ID, or -1.
+int32_t PropertyWatch_Add(uint32_t entityHandle, const char* className, const char* fieldName, int32_t size);
+
+// Stop watching (IDs are reused)
+void PropertyWatch_Remove(int32_t id);
+
+// Snapshot, diff and deliver changes (game thread, once per frame)
+void PropertyWatch_OnGameFrame();
+
+// Remove every watch and report each one to Go as removed (map end),
+// the same way a watch on a deleted entity is reported
+void PropertyWatch_OnMapEnd();
+
+// Drop every watch
+void PropertyWatch_Shutdown();
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_PROPERTY_WATCH_H
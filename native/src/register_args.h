@@ -0,0 +1,106 @@
+// register_args.h - SysV x86-64 register argument marshalling
+// Shared by the generic hook manager and native call thunks. A function whose
+// arguments all travel in registers can be called (or impersonated) through a
+// single shape taking the six integer and eight SSE argument registers; float
+// values ride in the low bits of the double parameters untouched.
+
+#ifndef GOSTRIKE_REGISTER_ARGS_H
+#define GOSTRIKE_REGISTER_ARGS_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+#include <cstring>
+
+namespace gostrike {
+
+constexpr int kIntArgRegs = 6;
+constexpr int kFloatArgRegs = 8;
+
+struct RegFile {
+    uint64_t i[kIntArgRegs];
+    double f[kFloatArgRegs];
+};
+
+typedef uint64_t (*IntRegFn)(uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t,
+                             double, double, double, double, double, double, double, double);
+typedef double (*FloatRegFn)(uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t,
+                             double, double, double, double, double, double, double, double);
+
+inline bool IsFloatArgType(int32_t type) {
+    return type == GS_HOOK_TYPE_FLOAT || type == GS_HOOK_TYPE_DOUBLE;
+}
+
+inline uint64_t DoubleBits(double d) {
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    return bits;
+}
+
+inline double BitsDouble(uint64_t bits) {
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
+
+// Assign each declared argument its register index (into RegFile::i or ::f).
+// Returns false if a type is invalid or the arguments don't fit in registers.
+inline bool AssignArgRegisters(const int32_t* argTypes, int32_t argc, int8_t* argReg) {
+    int intRegs = 0, floatRegs = 0;
+    for (int32_t a = 0; a < argc; a++) {
+        if (argTypes[a] <= GS_HOOK_TYPE_VOID || argTypes[a] > GS_HOOK_TYPE_VECTOR) return false;
+        argReg[a] = static_cast<int8_t>(IsFloatArgType(argTypes[a]) ? floatRegs++ : intRegs++);
+    }
+    return intRegs <= kIntArgRegs && floatRegs <= kFloatArgRegs;
+}
+
+// Register value -> normalized 64-bit slot (INT32 sign-extended, FLOAT as IEEE bits)
+inline uint64_t PackRegArg(int32_t type, const RegFile& regs, int8_t reg) {
+    switch (type) {
+    case GS_HOOK_TYPE_INT32:
+        return static_cast<uint64_t>(static_cast<int64_t>(static_cast<int32_t>(regs.i[reg])));
+    case GS_HOOK_TYPE_BOOL:
+        return (regs.i[reg] & 0xFF) != 0;
+    case GS_HOOK_TYPE_FLOAT:
+        return DoubleBits(regs.f[reg]) & 0xFFFFFFFFull;
+    case GS_HOOK_TYPE_DOUBLE:
+        return DoubleBits(regs.f[reg]);
+    default:
+        return regs.i[reg];
+    }
+}
+
+// Normalized 64-bit slot -> register value
+inline void UnpackRegArg(int32_t type, uint64_t value, RegFile& regs, int8_t reg) {
+    if (IsFloatArgType(type)) {
+        regs.f[reg] = BitsDouble(value);
+    } else {
+        regs.i[reg] = value;
+    }
+}
+
+// Call fn with the register file; returns the normalized return value
+inline uint64_t CallWithRegisters(void* fn, int32_t retType, const RegFile& regs) {
+    if (IsFloatArgType(retType)) {
+        double r = reinterpret_cast<FloatRegFn>(fn)(
+            regs.i[0], regs.i[1], regs.i[2], regs.i[3], regs.i[4], regs.i[5],
+            regs.f[0], regs.f[1], regs.f[2], regs.f[3], regs.f[4], regs.f[5], regs.f[6], regs.f[7]);
+        return retType == GS_HOOK_TYPE_FLOAT ? (DoubleBits(r) & 0xFFFFFFFFull) : DoubleBits(r);
+    }
+    uint64_t r = reinterpret_cast<IntRegFn>(fn)(
+        regs.i[0], regs.i[1], regs.i[2], regs.i[3], regs.i[4], regs.i[5],
+        regs.f[0], regs.f[1], regs.f[2], regs.f[3], regs.f[4], regs.f[5], regs.f[6], regs.f[7]);
+    switch (retType) {
+    case GS_HOOK_TYPE_VOID:
+        return 0;
+    case GS_HOOK_TYPE_INT32:
+        return static_cast<uint64_t>(static_cast<int64_t>(static_cast<int32_t>(r)));
+    case GS_HOOK_TYPE_BOOL:
+        return (r & 0xFF) != 0;
+    default:
+        return r;
+    }
+}
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_REGISTER_ARGS_H
@@ -4,10 +4,13 @@
 
 #include "schema.h"
 #include "gostrike.h"
+#include "entity_system.h"
 
 #include <cstdio>
+#include <algorithm>
 #include <cstring>
 #include <unordered_map>
+#include <vector>
 #include <string>
 
 #ifndef USE_STUB_SDK
@@ -61,6 +64,47 @@ static bool IsFieldNetworked(SchemaClassFieldData_t& field) {
     }
     return false;
 }
+
+// Find a class in the server module scope first, then the global scope
+static SchemaClassInfoData_t* FindClass(const char* className) {
+    if (!gs_pSchemaSystem) return nullptr;
+
+    // Find type scope for the server module (Linux uses libserver.so, Windows uses server.dll)
+#ifdef _WIN32
+    CSchemaSystemTypeScope* pScope = gs_pSchemaSystem->FindTypeScopeForModule("server.dll");
+#else
+    CSchemaSystemTypeScope* pScope = gs_pSchemaSystem->FindTypeScopeForModule("libserver.so");
+    if (!pScope) {
+        pScope = gs_pSchemaSystem->FindTypeScopeForModule("server.dll");
+    }
+#endif
+    if (!pScope) {
+        printf("[GoStrike] Schema: could not find type scope for server module\n");
+        return nullptr;
+    }
+
+    SchemaClassInfoData_t* pClassInfo = pScope->FindDeclaredClass(className).Get();
+    if (!pClassInfo) {
+        // Some classes live in the global type scope
+        CSchemaSystemTypeScope* pGlobal = gs_pSchemaSystem->GlobalTypeScope();
+        if (pGlobal) {
+            pClassInfo = pGlobal->FindDeclaredClass(className).Get();
+        }
+    }
+    return pClassInfo;
+}
+
+// Cache every field of one class (no overwrite: the class's own fields win over its base)
+static int32_t CacheFields(const char* className, SchemaClassInfoData_t* pClassInfo) {
+    int32_t added = 0;
+    for (int i = 0; i < pClassInfo->m_nFieldCount; i++) {
+        SchemaClassFieldData_t& field = pClassInfo->m_pFields[i];
+        if (!field.m_pszName) continue;
+        SchemaKey value = {field.m_nSingleInheritanceOffset, IsFieldNetworked(field)};
+        if (s_cache.emplace(CombinedHash(className, field.m_pszName), value).second) added++;
+    }
+    return added;
+}
 #endif
 
 void Initialize() {
@@ -114,29 +158,7 @@ SchemaKey GetOffset(const char* className, const char* fieldName) {
         return {0, false};
     }
 
-    // Find type scope for the server module (Linux uses libserver.so, Windows uses server.dll)
-#ifdef _WIN32
-    CSchemaSystemTypeScope* pScope = gs_pSchemaSystem->FindTypeScopeForModule("server.dll");
-#else
-    CSchemaSystemTypeScope* pScope = gs_pSchemaSystem->FindTypeScopeForModule("libserver.so");
-    if (!pScope) {
-        pScope = gs_pSchemaSystem->FindTypeScopeForModule("server.dll");
-    }
-#endif
-    if (!pScope) {
-        printf("[GoStrike] Schema: could not find type scope for server module\n");
-        return {0, false};
-    }
-
-    // Find the class in module scope first, then try global scope
-    SchemaClassInfoData_t* pClassInfo = pScope->FindDeclaredClass(className).Get();
-    if (!pClassInfo) {
-        // Some classes live in the global type scope
-        CSchemaSystemTypeScope* pGlobal = gs_pSchemaSystem->GlobalTypeScope();
-        if (pGlobal) {
-            pClassInfo = pGlobal->FindDeclaredClass(className).Get();
-        }
-    }
+    SchemaClassInfoData_t* pClassInfo = FindClass(className);
     if (!pClassInfo) {
         printf("[GoStrike] Schema: class '%s' not found in module or global scope\n", className);
         s_cache[key] = {0, false};
@@ -184,6 +206,27 @@ SchemaKey GetOffset(const char* className, const char* fieldName) {
     return {0, false};
 }
 
+int32_t PrewarmClass(const char* className) {
+    if (!className) return 0;
+
+#ifndef USE_STUB_SDK
+    SchemaClassInfoData_t* pClassInfo = FindClass(className);
+    if (!pClassInfo || !pClassInfo->m_pFields) return 0;
+
+    // Same lookup depth as GetOffset: the class, then its direct base
+    int32_t added = CacheFields(className, pClassInfo);
+    if (pClassInfo->m_pBaseClasses) {
+        SchemaClassInfoData_t* baseClass = pClassInfo->m_pBaseClasses->m_pClass;
+        if (baseClass && baseClass->m_pFields) {
+            added += CacheFields(className, baseClass);
+        }
+    }
+    return added;
+#else
+    return 0;
+#endif
+}
+
 void SetStateChanged(void* entity, const char* className, const char* fieldName, int32_t fieldOffset) {
     if (!entity) return;
 
@@ -199,5 +242,66 @@ void SetStateChanged(void* entity, const char* className, const char* fieldName,
 #endif
 }
 
+// ============================================================
+// Coalesced state change notifications
+// ============================================================
+
+// Queued by handle so an entity deleted before the flush resolves to nullptr
+struct DirtyField {
+    uint32_t handle;
+    int32_t offset;
+
+    bool operator<(const DirtyField& o) const {
+        return handle != o.handle ? handle < o.handle : offset < o.offset;
+    }
+    bool operator==(const DirtyField& o) const {
+        return handle == o.handle && offset == o.offset;
+    }
+};
+
+static std::vector<DirtyField> s_dirty;
+
+void QueueStateChanged(void* entity, int32_t fieldOffset) {
+#ifndef USE_STUB_SDK
+    if (!entity || fieldOffset <= 0) return;
+    uint32_t handle = EntitySystem_GetEntityHandle(entity);
+    if (handle == GS_INVALID_HANDLE) return;
+    s_dirty.push_back({handle, fieldOffset});
+#else
+    (void)entity;
+    (void)fieldOffset;
+#endif
+}
+
+void FlushStateChanged() {
+    if (s_dirty.empty()) return;
+
+#ifndef USE_STUB_SDK
+    // Sort so duplicates are adjacent and each entity is resolved once.
+    // NetworkStateChangedData carries a single offset, so distinct fields
+    // still need one notification each.
+    std::sort(s_dirty.begin(), s_dirty.end());
+    auto end = std::unique(s_dirty.begin(), s_dirty.end());
+
+    uint32_t lastHandle = GS_INVALID_HANDLE;
+    CEntityInstance* pEntity = nullptr;
+    for (auto it = s_dirty.begin(); it != end; ++it) {
+        if (it->handle != lastHandle) {
+            lastHandle = it->handle;
+            pEntity = static_cast<CEntityInstance*>(EntitySystem_GetEntityByHandle(it->handle));
+        }
+        if (!pEntity) continue;
+        NetworkStateChangedData data(static_cast<uint32_t>(it->offset));
+        pEntity->NetworkStateChanged(data);
+    }
+#endif
+
+    s_dirty.clear();
+}
+
+void ClearStateChanged() {
+    s_dirty.clear();
+}
+
 } // namespace schema
 } // namespace gostrike
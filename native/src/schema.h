@@ -25,6 +25,11 @@ void Initialize();
 // Results are cached for subsequent lookups.
 SchemaKey GetOffset(const char* className, const char* fieldName);
 
+// Resolve every field of a class (and its direct base) into the cache in one
+// pass, so later GetOffset calls for it are hash lookups.
+// Returns the number of fields added.
+int32_t PrewarmClass(const char* className);
+
 // Notify the engine that a networked field has changed.
 // entity: pointer to the entity (CBaseEntity*)
 // className: schema class name
@@ -32,6 +37,17 @@ SchemaKey GetOffset(const char* className, const char* fieldName);
 // fieldOffset: byte offset of the field within the entity
 void SetStateChanged(void* entity, const char* className, const char* fieldName, int32_t fieldOffset);
 
+// Record a networked field change to be reported by FlushStateChanged.
+// Repeated writes to the same field within a frame produce one notification.
+void QueueStateChanged(void* entity, int32_t fieldOffset);
+
+// Send one NetworkStateChanged per distinct (entity, offset) queued since the
+// last flush. Entities deleted in the meantime are skipped.
+void FlushStateChanged();
+
+// Drop queued changes without notifying (shutdown)
+void ClearStateChanged();
+
 } // namespace schema
 } // namespace gostrike
 
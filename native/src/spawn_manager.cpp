@@ -0,0 +1,126 @@
+// spawn_manager.cpp - Batched entity creation and removal
+// Spawn flow modelled on CounterStrikeSharp / CS2Fixes entity creation helpers:
+// UTIL_CreateEntityByName -> CEntityKeyValues -> CBaseEntity::DispatchSpawn
+
+#include "spawn_manager.h"
+#include "gostrike.h"
+#include "gameconfig.h"
+#include "entity_system.h"
+
+#include <cstdio>
+
+#ifndef USE_STUB_SDK
+#include <entity2/entityinstance.h>
+#include <entity2/entitykeyvalues.h>
+#endif
+
+namespace gostrike {
+
+#ifndef USE_STUB_SDK
+// CBaseEntity* UTIL_CreateEntityByName(const char* className, int forceEdictIndex)
+typedef CEntityInstance* (*CreateEntityByNameFn)(const char*, int);
+// void CBaseEntity::DispatchSpawn(CEntityKeyValues* pKeyValues)
+typedef void (*DispatchSpawnFn)(CEntityInstance*, CEntityKeyValues*);
+// void UTIL_Remove(CEntityInstance* pEntity)
+typedef void (*RemoveFn)(CEntityInstance*);
+
+static CreateEntityByNameFn s_fnCreateEntityByName = nullptr;
+static DispatchSpawnFn s_fnDispatchSpawn = nullptr;
+static RemoveFn s_fnRemove = nullptr;
+#endif
+
+void SpawnManager_Initialize() {
+#ifndef USE_STUB_SDK
+    s_fnCreateEntityByName = reinterpret_cast<CreateEntityByNameFn>(
+        g_gameConfig.ResolveSignature("UTIL_CreateEntityByName"));
+    s_fnDispatchSpawn = reinterpret_cast<DispatchSpawnFn>(
+        g_gameConfig.ResolveSignature("CBaseEntity_DispatchSpawn"));
+    s_fnRemove = reinterpret_cast<RemoveFn>(
+        g_gameConfig.ResolveSignature("UTIL_Remove"));
+
+    printf("[GoStrike] SpawnManager: initialized (create=%p, spawn=%p, remove=%p)\n",
+           (void*)s_fnCreateEntityByName, (void*)s_fnDispatchSpawn, (void*)s_fnRemove);
+#else
+    printf("[GoStrike] SpawnManager: stub mode, entity spawning disabled\n");
+#endif
+}
+
+int32_t SpawnManager_SpawnEntities(const gs_spawn_spec_t* specs, int32_t count, gs_entity_ref_t* out) {
+    if (!specs || !out || count <= 0) return 0;
+
+    for (int32_t i = 0; i < count; i++) {
+        out[i].index = 0;
+        out[i].handle = GS_INVALID_HANDLE;
+        out[i].entity = nullptr;
+        out[i].classname = nullptr;
+    }
+
+#ifndef USE_STUB_SDK
+    if (!s_fnCreateEntityByName || !s_fnDispatchSpawn) {
+        printf("[GoStrike] SpawnManager: CreateEntityByName/DispatchSpawn not resolved\n");
+        return 0;
+    }
+
+    int32_t spawned = 0;
+    for (int32_t i = 0; i < count; i++) {
+        const gs_spawn_spec_t& spec = specs[i];
+        if (!spec.classname || spec.classname[0] == '\0') continue;
+
+        CEntityInstance* pEntity = s_fnCreateEntityByName(spec.classname, -1);
+        if (!pEntity) {
+            printf("[GoStrike] SpawnManager: failed to create '%s'\n", spec.classname);
+            continue;
+        }
+
+        // Key-values are consumed by DispatchSpawn (the engine takes ownership)
+        CEntityKeyValues* pKeyValues = new CEntityKeyValues();
+        pKeyValues->SetVector("origin", Vector(spec.origin.x, spec.origin.y, spec.origin.z));
+        pKeyValues->SetQAngle("angles", QAngle(spec.angles.x, spec.angles.y, spec.angles.z));
+        if (spec.model && spec.model[0] != '\0') {
+            pKeyValues->SetString("model", spec.model);
+        }
+        for (int32_t k = 0; k < spec.keyvalue_count && spec.keyvalues; k++) {
+            const gs_keyvalue_t& kv = spec.keyvalues[k];
+            if (kv.key && kv.value) {
+                pKeyValues->SetString(kv.key, kv.value);
+            }
+        }
+
+        s_fnDispatchSpawn(pEntity, pKeyValues);
+
+        if (!pEntity->m_pEntity) continue;
+        out[i].index = pEntity->m_pEntity->m_EHandle.GetEntryIndex();
+        out[i].handle = pEntity->m_pEntity->m_EHandle.ToInt();
+        out[i].entity = static_cast<void*>(pEntity);
+        out[i].classname = pEntity->GetClassname();
+        spawned++;
+    }
+    return spawned;
+#else
+    return 0;
+#endif
+}
+
+int32_t SpawnManager_RemoveEntities(const uint32_t* handles, int32_t count) {
+    if (!handles || count <= 0) return 0;
+
+#ifndef USE_STUB_SDK
+    if (!s_fnRemove) {
+        printf("[GoStrike] SpawnManager: UTIL_Remove not resolved\n");
+        return 0;
+    }
+
+    int32_t removed = 0;
+    for (int32_t i = 0; i < count; i++) {
+        void* entity = EntitySystem_GetEntityByHandle(handles[i]);
+        if (!entity) continue;
+        s_fnRemove(static_cast<CEntityInstance*>(entity));
+        removed++;
+    }
+    return removed;
+#else
+    return 0;
+#endif
+}
+
+} // namespace gostrike
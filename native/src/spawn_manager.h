@@ -0,0 +1,26 @@
+// spawn_manager.h - Batched entity creation and removal
+// Uses UTIL_CreateEntityByName, CBaseEntity::DispatchSpawn and UTIL_Remove from gamedata.
+// Spawn flow modelled on CounterStrikeSharp / CS2Fixes entity creation helpers.
+
+#ifndef GOSTRIKE_SPAWN_MANAGER_H
+#define GOSTRIKE_SPAWN_MANAGER_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Resolve the entity creation functions from gamedata
+void SpawnManager_Initialize();
+
+// Create, configure and spawn every spec in order (game thread only).
+// out receives one ref per spec; failures are marked with GS_INVALID_HANDLE.
+// Returns the number of entities spawned.
+int32_t SpawnManager_SpawnEntities(const gs_spawn_spec_t* specs, int32_t count, gs_entity_ref_t* out);
+
+// Remove entities by handle (game thread only). Returns the number removed.
+int32_t SpawnManager_RemoveEntities(const uint32_t* handles, int32_t count);
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_SPAWN_MANAGER_H
@@ -0,0 +1,50 @@
+// string_table.cpp - Interned native strings
+//
+// Strings are stored once in a deque, so pointers returned by StringTable_Get
+// never move, and indexed by content for interning. IDs are 1-based; 0 is
+// the empty string. The table is locked because Go may resolve an ID from
+// outside the game thread.
+//
+// Only bounded sets belong here (classnames, event names): the
+// table never shrinks until unload. Player-controlled strings do not.
+
+#include "string_table.h"
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace gostrike {
+
+static std::mutex s_lock;
+static std::deque<std::string> s_strings;
+static std::unordered_map<std::string_view, uint32_t> s_ids;  // views into s_strings
+
+uint32_t StringTable_Intern(const char* str) {
+    if (!str || !*str) return 0;
+
+    std::lock_guard<std::mutex> guard(s_lock);
+    auto it = s_ids.find(std::string_view(str));
+    if (it != s_ids.end()) return it->second;
+
+    const std::string& stored = s_strings.emplace_back(str);
+    uint32_t id = (uint32_t)s_strings.size();
+    s_ids.emplace(std::string_view(stored), id);
+    return id;
+}
+
+const char* StringTable_Get(uint32_t id) {
+    std::lock_guard<std::mutex> guard(s_lock);
+    if (id == 0 || id > s_strings.size()) return nullptr;
+    return s_strings[id - 1].c_str();
+}
+
+void StringTable_Shutdown() {
+    std::lock_guard<std::mutex> guard(s_lock);
+    s_ids.clear();
+    s_strings.clear();
+}
+
+} // namespace gostrike
@@ -0,0 +1,27 @@
+// string_table.h - Interned native strings
+// Classnames and event names are interned once and handed to Go as small
+// stable IDs. Go converts each ID to a Go string the first time
+// it sees it and reuses that string afterwards.
+
+#ifndef GOSTRIKE_STRING_TABLE_H
+#define GOSTRIKE_STRING_TABLE_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Intern a string. Returns its ID, or 0 for a null or empty string.
+// IDs stay valid until StringTable_Shutdown.
+uint32_t StringTable_Intern(const char* str);
+
+// String for an ID, or nullptr if the ID is unknown (0 included)
+const char* StringTable_Get(uint32_t id);
+
+// Drop every interned string (plugin unload only). IDs restart from 1
+// afterwards, so Go drops its cached copies in GoStrike_Init.
+void StringTable_Shutdown();
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_STRING_TABLE_H
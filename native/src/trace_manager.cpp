@@ -0,0 +1,151 @@
+// trace_manager.cpp - Engine ray traces
+// Trace entry point and filter construction follow CS2Fixes:
+//   void TracePlayerBBox(const Vector& start, const Vector& end, const BBoxData_t& bounds,
+//                        CTraceFilter* filter, trace_t& pm)
+
+#include "trace_manager.h"
+#include "gameconfig.h"
+#include "entity_system.h"
+
+#include <cstdio>
+#include <cstring>
+#include <optional>
+
+#ifndef USE_STUB_SDK
+#include <gametrace.h>
+#include <entity2/entityinstance.h>
+#endif
+
+namespace gostrike {
+
+#ifndef USE_STUB_SDK
+struct GsBBoxData {
+    Vector mins;
+    Vector maxs;
+};
+
+typedef void (*TracePlayerBBoxFn)(const Vector&, const Vector&, const GsBBoxData&, CTraceFilter*, CGameTrace&);
+
+static TracePlayerBBoxFn s_fnTracePlayerBBox = nullptr;
+#endif
+
+void TraceManager_Initialize() {
+#ifndef USE_STUB_SDK
+    s_fnTracePlayerBBox = reinterpret_cast<TracePlayerBBoxFn>(
+        g_gameConfig.ResolveSignature("TracePlayerBBox"));
+    if (!s_fnTracePlayerBBox) {
+        printf("[GoStrike] TraceManager: TracePlayerBBox not resolved, traces and visibility unavailable\n");
+        return;
+    }
+    printf("[GoStrike] TraceManager: initialized (trace=%p)\n", (void*)s_fnTracePlayerBBox);
+#else
+    printf("[GoStrike] TraceManager: stub mode, traces disabled\n");
+#endif
+}
+
+bool TraceManager_IsAvailable() {
+#ifndef USE_STUB_SDK
+    return s_fnTracePlayerBBox != nullptr;
+#else
+    return false;
+#endif
+}
+
+bool TraceManager_TraceLine(const float start[3], const float end[3], uint64_t mask,
+                            void* ignore, TraceHit* out) {
+    if (out) memset(out, 0, sizeof(*out));
+
+#ifndef USE_STUB_SDK
+    if (!s_fnTracePlayerBBox || !start || !end) return false;
+
+    Vector vStart(start[0], start[1], start[2]);
+    Vector vEnd(end[0], end[1], end[2]);
+    GsBBoxData bounds = { Vector(0, 0, 0), Vector(0, 0, 0) };
+
+    CTraceFilter filter(static_cast<CEntityInstance*>(ignore), nullptr, 0xFFFF, mask,
+                        COLLISION_GROUP_DEFAULT, true);
+    CGameTrace trace;
+    s_fnTracePlayerBBox(vStart, vEnd, bounds, &filter, trace);
+
+    bool hit = trace.DidHit();
+    if (out) {
+        out->hit = hit;
+        out->fraction = trace.m_flFraction;
+        out->end[0] = trace.m_vEndPos.x;
+        out->end[1] = trace.m_vEndPos.y;
+        out->end[2] = trace.m_vEndPos.z;
+        out->normal[0] = trace.m_vHitNormal.x;
+        out->normal[1] = trace.m_vHitNormal.y;
+        out->normal[2] = trace.m_vHitNormal.z;
+        out->entity = static_cast<void*>(trace.m_pEnt);
+    }
+    return hit;
+#else
+    (void)start; (void)end; (void)mask; (void)ignore;
+    return false;
+#endif
+}
+
+int32_t TraceManager_TraceBatch(const gs_ray_t* rays, int32_t count, uint64_t mask, uint32_t flags,
+                                gs_trace_result_t* out) {
+    if (!rays || count <= 0) return 0;
+    if (out) memset(out, 0, sizeof(gs_trace_result_t) * count);
+
+#ifndef USE_STUB_SDK
+    if (!s_fnTracePlayerBBox) return 0;
+
+    // Filters are only rebuilt when the ignored entity changes between rays
+    std::optional<CTraceFilter> filter;
+    uint32_t filterIgnore = 0;
+
+    int32_t hits = 0;
+    for (int32_t i = 0; i < count; i++) {
+        const gs_ray_t& ray = rays[i];
+
+        if (!filter || ray.ignore != filterIgnore) {
+            auto* pIgnore = static_cast<CEntityInstance*>(EntitySystem_GetEntityByHandle(ray.ignore));
+            filter.emplace(pIgnore, nullptr, 0xFFFF, mask, COLLISION_GROUP_DEFAULT, true);
+            filterIgnore = ray.ignore;
+        }
+
+        Vector vStart(ray.start.x, ray.start.y, ray.start.z);
+        Vector vEnd(ray.end.x, ray.end.y, ray.end.z);
+        GsBBoxData bounds = { Vector(ray.mins.x, ray.mins.y, ray.mins.z),
+                              Vector(ray.maxs.x, ray.maxs.y, ray.maxs.z) };
+        CGameTrace trace;
+        s_fnTracePlayerBBox(vStart, vEnd, bounds, &*filter, trace);
+
+        bool hit = trace.DidHit();
+        if (out) {
+            gs_trace_result_t& res = out[i];
+            res.hit = hit;
+            res.start_solid = trace.m_bStartInSolid;
+            res.fraction = trace.m_flFraction;
+            res.end = { trace.m_vEndPos.x, trace.m_vEndPos.y, trace.m_vEndPos.z };
+            res.normal = { trace.m_vHitNormal.x, trace.m_vHitNormal.y, trace.m_vHitNormal.z };
+            res.entity.handle = GS_INVALID_HANDLE;
+            void* pEnt = static_cast<void*>(trace.m_pEnt);
+            if (hit && pEnt) {
+                uint32_t index = EntitySystem_GetEntityIndex(pEnt);
+                if (index != 0) {  // world hits report no entity
+                    res.entity.index = index;
+                    res.entity.handle = EntitySystem_GetEntityHandle(pEnt);
+                    res.entity.entity = pEnt;
+                    res.entity.classname = EntitySystem_GetEntityClassname(pEnt);
+                }
+            }
+        }
+
+        if (hit) {
+            hits++;
+            if (flags & GS_TRACE_ANY_HIT) break;
+        }
+    }
+    return hits;
+#else
+    (void)mask; (void)flags;
+    return 0;
+#endif
+}
+
+} // namespace gostrike
@@ -0,0 +1,44 @@
+// trace_manager.h - Engine ray traces
+// Uses TracePlayerBBox from gamedata (CS2Fixes' trace entry point); a zero-size
+// box makes it a line trace.
+
+#ifndef GOSTRIKE_TRACE_MANAGER_H
+#define GOSTRIKE_TRACE_MANAGER_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Geometry that blocks sight between players (players themselves never block)
+constexpr uint64_t kTraceMaskVisibility = GS_TRACE_CONTENTS_SOLID | GS_TRACE_CONTENTS_BLOCK_LOS |
+                                          GS_TRACE_CONTENTS_WORLD_GEOMETRY;
+
+// Result of a single trace
+struct TraceHit {
+    bool hit;
+    float fraction;
+    float end[3];
+    float normal[3];
+    void* entity;  // CEntityInstance* that was hit, nullptr for world/no hit
+};
+
+// Resolve the trace function from gamedata
+void TraceManager_Initialize();
+
+// True once the trace function has been resolved
+bool TraceManager_IsAvailable();
+
+// Trace a line from start to end against geometry matching mask (game thread only).
+// ignore: entity to pass through, may be nullptr. Returns true if something was hit.
+bool TraceManager_TraceLine(const float start[3], const float end[3], uint64_t mask,
+                            void* ignore, TraceHit* out);
+
+// Trace a batch of rays in one call (game thread only). Consecutive rays with the
+// same ignore handle share one trace filter. Returns the number of rays that hit.
+int32_t TraceManager_TraceBatch(const gs_ray_t* rays, int32_t count, uint64_t mask, uint32_t flags,
+                                gs_trace_result_t* out);
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_TRACE_MANAGER_H
@@ -0,0 +1,138 @@
+// transmit_manager.cpp - Per-player entity transmit filtering
+// CCheckTransmitInfo layout and player slot offset follow CounterStrikeSharp's
+// CheckTransmit listener. The engine's transmit set is a CBitVec<16384>, which
+// stores its bits inline as 512 uint32 words; the hidden sets use the same word
+// layout so applying them is a plain AND-NOT loop the compiler can vectorize.
+
+#include "transmit_manager.h"
+#include "gameconfig.h"
+#include "visibility_manager.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace gostrike {
+
+static constexpr int kMaxSlots = 64;
+static constexpr uint32_t kMaxTransmitEntities = 16384;
+static constexpr int kTransmitWords = kMaxTransmitEntities / 32;
+
+// Hidden entities for one player slot. [lo, hi] bounds the words that may hold
+// set bits, so sparse sets (a handful of props) only touch a few words per tick.
+struct HiddenSet {
+    alignas(64) uint32_t words[kTransmitWords];
+    int32_t count;
+    int32_t lo;
+    int32_t hi;
+};
+
+static HiddenSet s_hidden[kMaxSlots];
+
+// Byte offset of the player slot inside CCheckTransmitInfo (gamedata: CheckTransmitPlayerSlot)
+static int s_playerSlotOffset = -1;
+
+// Only the first member of CCheckTransmitInfo is needed: the transmit bitvec
+struct GsCheckTransmitInfo {
+    uint32_t* m_pTransmitEntity;
+};
+
+static void ResetSet(HiddenSet& set) {
+    memset(set.words, 0, sizeof(set.words));
+    set.count = 0;
+    set.lo = kTransmitWords;
+    set.hi = -1;
+}
+
+static void SetBit(HiddenSet& set, uint32_t index, bool hidden) {
+    int32_t word = static_cast<int32_t>(index >> 5);
+    uint32_t mask = 1u << (index & 31);
+    bool wasHidden = (set.words[word] & mask) != 0;
+    if (hidden == wasHidden) return;
+
+    if (hidden) {
+        set.words[word] |= mask;
+        set.count++;
+        if (word < set.lo) set.lo = word;
+        if (word > set.hi) set.hi = word;
+    } else {
+        set.words[word] &= ~mask;
+        if (--set.count == 0) {
+            set.lo = kTransmitWords;
+            set.hi = -1;
+        }
+    }
+}
+
+void TransmitManager_Initialize() {
+    for (int i = 0; i < kMaxSlots; i++) {
+        ResetSet(s_hidden[i]);
+    }
+
+    s_playerSlotOffset = g_gameConfig.GetOffset("CheckTransmitPlayerSlot");
+    if (s_playerSlotOffset < 0) {
+        printf("[GoStrike] TransmitManager: CheckTransmitPlayerSlot offset not found, transmit filtering disabled\n");
+        return;
+    }
+    printf("[GoStrike] TransmitManager: initialized (player slot offset=%d)\n", s_playerSlotOffset);
+}
+
+void TransmitManager_SetHidden(int32_t slot, const uint32_t* indices, int32_t count, bool hidden) {
+    if (!indices || count <= 0 || slot < -1 || slot >= kMaxSlots) return;
+
+    int32_t first = (slot == -1) ? 0 : slot;
+    int32_t last = (slot == -1) ? kMaxSlots - 1 : slot;
+    for (int32_t i = 0; i < count; i++) {
+        uint32_t index = indices[i];
+        // Never hide the world entity
+        if (index == 0 || index >= kMaxTransmitEntities) continue;
+        for (int32_t s = first; s <= last; s++) {
+            SetBit(s_hidden[s], index, hidden);
+        }
+    }
+}
+
+void TransmitManager_ClearSlot(int32_t slot) {
+    if (slot == -1) {
+        for (int i = 0; i < kMaxSlots; i++) {
+            ResetSet(s_hidden[i]);
+        }
+        return;
+    }
+    if (slot < 0 || slot >= kMaxSlots) return;
+    ResetSet(s_hidden[slot]);
+}
+
+void TransmitManager_OnEntityDeleted(uint32_t index) {
+    if (index == 0 || index >= kMaxTransmitEntities) return;
+    for (int i = 0; i < kMaxSlots; i++) {
+        if (s_hidden[i].count > 0) {
+            SetBit(s_hidden[i], index, false);
+        }
+    }
+}
+
+void TransmitManager_Apply(void** infos, int32_t infoCount) {
+    if (!infos || infoCount <= 0 || s_playerSlotOffset < 0) return;
+
+    for (int32_t i = 0; i < infoCount; i++) {
+        auto* pInfo = static_cast<GsCheckTransmitInfo*>(infos[i]);
+        if (!pInfo || !pInfo->m_pTransmitEntity) continue;
+
+        int32_t slot = *reinterpret_cast<int32_t*>(reinterpret_cast<uint8_t*>(pInfo) + s_playerSlotOffset);
+        if (slot < 0 || slot >= kMaxSlots) continue;
+
+        // Enemies the viewer has no line of sight to (visibility_manager)
+        VisibilityManager_ApplyTransmit(slot, pInfo->m_pTransmitEntity);
+
+        const HiddenSet& set = s_hidden[slot];
+        if (set.count == 0) continue;
+
+        uint32_t* __restrict transmit = pInfo->m_pTransmitEntity;
+        const uint32_t* __restrict hidden = set.words;
+        for (int32_t w = set.lo; w <= set.hi; w++) {
+            transmit[w] &= ~hidden[w];
+        }
+    }
+}
+
+} // namespace gostrike
@@ -0,0 +1,31 @@
+// transmit_manager.h - Per-player entity transmit filtering
+// Keeps, per player slot, a bitset of entity indices that must not be
+// transmitted to that player. The CheckTransmit post-hook (gostrike.cpp)
+// applies it to the engine's transmit bitvec without calling into Go.
+
+#ifndef GOSTRIKE_TRANSMIT_MANAGER_H
+#define GOSTRIKE_TRANSMIT_MANAGER_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Load the CCheckTransmitInfo player slot offset from gamedata
+void TransmitManager_Initialize();
+
+// Hide (or unhide) entity indices from a player. slot -1 applies to every slot.
+void TransmitManager_SetHidden(int32_t slot, const uint32_t* indices, int32_t count, bool hidden);
+
+// Clear every hidden entity for a slot (-1 = all slots)
+void TransmitManager_ClearSlot(int32_t slot);
+
+// Unhide a deleted entity's index for every slot, so the next entity using it is visible
+void TransmitManager_OnEntityDeleted(uint32_t index);
+
+// Apply the hidden sets to the engine's CCheckTransmitInfo array (CheckTransmit post-hook)
+void TransmitManager_Apply(void** infos, int32_t infoCount);
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_TRANSMIT_MANAGER_H
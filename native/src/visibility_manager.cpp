@@ -0,0 +1,355 @@
+// visibility_manager.cpp - Player-to-player line-of-sight matrix
+//
+// A sweep snapshots every living player's eye position, view direction, team and
+// pawn, then walks the unordered pairs. Cheap tests run first: pairs beyond
+// max_distance, or outside both players' view cones, never reach a trace. Line of
+// sight is symmetric, so each surviving pair is traced once (eye -> head, then
+// eye -> chest) and the result is applied per direction through the view cones.
+// Pairs are processed until the per-tick budget runs out and the sweep resumes
+// next tick; the matrix is only published when a sweep completes.
+//
+// The transmit filter uses its own mask, built from distance and line of sight
+// only: an enemy behind a player must still be networked, or they would pop in
+// when the player turns. Because the mask is several ticks old when it is used,
+// it is padded. Each enemy pair is also traced between positions extrapolated
+// by the pair's velocities over the mask's age, and a pair stays transmitted for
+// one more sweep after it was last seen.
+//
+// Sweeps need engine traces. Without TracePlayerBBox in gamedata the subsystem
+// reports itself unavailable and never publishes, rather than treating every
+// pair as visible.
+//
+// Eye height is a fixed standing offset. A crouching viewer is treated as
+// standing, which can only make players more visible, never less.
+
+#include "visibility_manager.h"
+#include "trace_manager.h"
+#include "player_manager.h"
+#include "entity_system.h"
+#include "schema.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace gostrike {
+
+static constexpr int kMaxSlots = 64;
+static constexpr float kEyeHeight = 64.0f;
+static constexpr float kChestHeight = 40.0f;
+static constexpr float kDegToRad = 3.14159265358979f / 180.0f;
+static constexpr float kTickInterval = 1.0f / 64.0f;
+static constexpr float kMaxLeadSeconds = 0.25f;  // cap on transmit extrapolation
+
+struct PlayerSnapshot {
+    bool active;
+    int32_t team;
+    uint32_t pawnIndex;
+    uint32_t pawnHandle;
+    float eye[3];
+    float forward[3];
+    float velocity[3];
+};
+
+static gs_visibility_config_t s_config;
+static float s_cosHalfFov = -1.0f;  // -1 = frustum culling disabled
+
+// Sweep in progress
+static PlayerSnapshot s_snapshot[kMaxSlots];
+static uint64_t s_building[kMaxSlots];
+static uint64_t s_buildingTransmit[kMaxSlots];
+static std::vector<std::pair<uint8_t, uint8_t>> s_pairs;
+static size_t s_pairCursor = 0;
+static bool s_sweeping = false;
+static int32_t s_ticksSinceSweep = 0;
+static int32_t s_sweepTicks = 0;      // ticks spent on the current sweep
+static int32_t s_lastSweepTicks = 0;  // ticks the previous sweep took
+static float s_leadSeconds = 0.0f;    // transmit extrapolation for this sweep
+
+// Last completed sweep
+static uint64_t s_published[kMaxSlots];
+static uint64_t s_publishedTransmit[kMaxSlots];      // distance + LOS, padded
+static uint64_t s_publishedTransmitPrev[kMaxSlots];  // the sweep before
+static uint64_t s_publishedActive = 0;
+static int32_t s_publishedTeam[kMaxSlots];
+static uint32_t s_publishedPawn[kMaxSlots];
+static int32_t s_generation = 0;
+
+void VisibilityManager_Initialize() {
+    memset(&s_config, 0, sizeof(s_config));
+    s_cosHalfFov = -1.0f;
+    s_sweeping = false;
+    s_pairCursor = 0;
+    s_ticksSinceSweep = 0;
+    s_sweepTicks = 0;
+    s_lastSweepTicks = 0;
+    s_pairs.clear();
+    memset(s_published, 0, sizeof(s_published));
+    memset(s_publishedTransmit, 0, sizeof(s_publishedTransmit));
+    memset(s_publishedTransmitPrev, 0, sizeof(s_publishedTransmitPrev));
+    memset(s_publishedPawn, 0, sizeof(s_publishedPawn));
+    s_publishedActive = 0;
+    s_generation = 0;
+}
+
+void VisibilityManager_Configure(const gs_visibility_config_t* config) {
+    if (!config) return;
+    s_config = *config;
+    if (s_config.budget_us <= 0) s_config.budget_us = 500;
+    s_cosHalfFov = (s_config.fov_degrees > 0.0f && s_config.fov_degrees < 360.0f)
+        ? std::cos(s_config.fov_degrees * 0.5f * kDegToRad)
+        : -1.0f;
+    printf("[GoStrike] VisibilityManager: interval=%d ticks, budget=%dus, max_distance=%.0f, fov=%.0f, transmit=%s\n",
+           s_config.interval_ticks, s_config.budget_us, s_config.max_distance, s_config.fov_degrees,
+           s_config.transmit_hide_enemies ? "on" : "off");
+    if (s_config.interval_ticks > 0 && !VisibilityManager_IsAvailable()) {
+        printf("[GoStrike] VisibilityManager: no engine traces (TracePlayerBBox), sweeps will not run\n");
+    }
+}
+
+bool VisibilityManager_IsAvailable() {
+    return TraceManager_IsAvailable();
+}
+
+#ifndef USE_STUB_SDK
+static bool ReadAbsOrigin(void* pawn, float out[3]) {
+    auto bodyKey = schema::GetOffset("CBaseEntity", "m_CBodyComponent");
+    auto sceneNodeKey = schema::GetOffset("CBodyComponent", "m_pSceneNode");
+    auto posKey = schema::GetOffset("CGameSceneNode", "m_vecAbsOrigin");
+    if (bodyKey.offset <= 0 || sceneNodeKey.offset <= 0 || posKey.offset <= 0) return false;
+
+    void* bodyComp = *reinterpret_cast<void**>(reinterpret_cast<uintptr_t>(pawn) + bodyKey.offset);
+    if (!bodyComp) return false;
+    void* sceneNode = *reinterpret_cast<void**>(reinterpret_cast<uintptr_t>(bodyComp) + sceneNodeKey.offset);
+    if (!sceneNode) return false;
+
+    const float* pos = reinterpret_cast<const float*>(reinterpret_cast<uintptr_t>(sceneNode) + posKey.offset);
+    out[0] = pos[0];
+    out[1] = pos[1];
+    out[2] = pos[2];
+    return true;
+}
+
+static void TakeSnapshot() {
+    auto aliveKey = schema::GetOffset("CCSPlayerController", "m_bPawnIsAlive");
+    auto teamKey = schema::GetOffset("CBaseEntity", "m_iTeamNum");
+    auto anglesKey = schema::GetOffset("CCSPlayerPawnBase", "m_angEyeAngles");
+    auto velocityKey = schema::GetOffset("CBaseEntity", "m_vecAbsVelocity");
+
+    for (int i = 0; i < kMaxSlots; i++) {
+        PlayerSnapshot& snap = s_snapshot[i];
+        snap.active = false;
+
+        void* controller = PlayerManager_GetController(i);
+        if (!controller) continue;
+        if (aliveKey.offset > 0 &&
+            !*reinterpret_cast<bool*>(reinterpret_cast<uintptr_t>(controller) + aliveKey.offset)) {
+            continue;
+        }
+
+        void* pawn = PlayerManager_GetPawn(i);
+        if (!pawn || !ReadAbsOrigin(pawn, snap.eye)) continue;
+        snap.eye[2] += kEyeHeight;
+
+        snap.team = teamKey.offset > 0
+            ? *reinterpret_cast<int32_t*>(reinterpret_cast<uintptr_t>(controller) + teamKey.offset)
+            : 0;
+        snap.pawnIndex = EntitySystem_GetEntityIndex(pawn);
+        snap.pawnHandle = EntitySystem_GetEntityHandle(pawn);
+
+        snap.forward[0] = snap.forward[1] = snap.forward[2] = 0.0f;
+        if (anglesKey.offset > 0) {
+            const float* ang = reinterpret_cast<const float*>(reinterpret_cast<uintptr_t>(pawn) + anglesKey.offset);
+            float pitch = ang[0] * kDegToRad;
+            float yaw = ang[1] * kDegToRad;
+            snap.forward[0] = std::cos(pitch) * std::cos(yaw);
+            snap.forward[1] = std::cos(pitch) * std::sin(yaw);
+            snap.forward[2] = -std::sin(pitch);
+        }
+
+        snap.velocity[0] = snap.velocity[1] = snap.velocity[2] = 0.0f;
+        if (velocityKey.offset > 0) {
+            const float* vel = reinterpret_cast<const float*>(reinterpret_cast<uintptr_t>(pawn) + velocityKey.offset);
+            snap.velocity[0] = vel[0];
+            snap.velocity[1] = vel[1];
+            snap.velocity[2] = vel[2];
+        }
+        snap.active = true;
+    }
+}
+#endif
+
+static void BeginSweep() {
+#ifndef USE_STUB_SDK
+    TakeSnapshot();
+#else
+    for (int i = 0; i < kMaxSlots; i++) s_snapshot[i].active = false;
+#endif
+
+    // The transmit mask is applied until the next sweep publishes, so its
+    // padding covers this sweep's interval plus about as long as the last one took
+    s_leadSeconds = std::min(static_cast<float>(s_config.interval_ticks + s_lastSweepTicks) * kTickInterval,
+                             kMaxLeadSeconds);
+
+    s_pairs.clear();
+    for (int i = 0; i < kMaxSlots; i++) {
+        s_building[i] = 0;
+        s_buildingTransmit[i] = 0;
+        if (!s_snapshot[i].active) continue;
+        s_building[i] = 1ull << i;  // players always see themselves
+        s_buildingTransmit[i] = 1ull << i;
+        for (int j = i + 1; j < kMaxSlots; j++) {
+            if (s_snapshot[j].active) {
+                s_pairs.emplace_back(static_cast<uint8_t>(i), static_cast<uint8_t>(j));
+            }
+        }
+    }
+    s_pairCursor = 0;
+    s_sweepTicks = 0;
+    s_sweeping = true;
+}
+
+// Is target inside viewer's view cone? (always true with frustum culling disabled)
+static bool InViewCone(const PlayerSnapshot& viewer, const PlayerSnapshot& target, float dist) {
+    if (s_cosHalfFov <= -1.0f || dist <= 0.0f) return true;
+    float dot = (target.eye[0] - viewer.eye[0]) * viewer.forward[0] +
+                (target.eye[1] - viewer.eye[1]) * viewer.forward[1] +
+                (target.eye[2] - viewer.eye[2]) * viewer.forward[2];
+    return dot >= s_cosHalfFov * dist;
+}
+
+// Eye -> head, then eye -> chest
+static bool HasLineOfSight(const float from[3], const float to[3], void* ignore) {
+    if (!TraceManager_TraceLine(from, to, kTraceMaskVisibility, ignore, nullptr)) return true;
+
+    float chest[3] = { to[0], to[1], to[2] - (kEyeHeight - kChestHeight) };
+    return !TraceManager_TraceLine(from, chest, kTraceMaskVisibility, ignore, nullptr);
+}
+
+// Line of sight between where both players will be after the lead time
+static bool HasPredictedLineOfSight(const PlayerSnapshot& a, const PlayerSnapshot& b, void* ignore) {
+    float from[3], to[3];
+    for (int k = 0; k < 3; k++) {
+        from[k] = a.eye[k] + a.velocity[k] * s_leadSeconds;
+        to[k] = b.eye[k] + b.velocity[k] * s_leadSeconds;
+    }
+    return HasLineOfSight(from, to, ignore);
+}
+
+static void ProcessPair(int i, int j) {
+    const PlayerSnapshot& a = s_snapshot[i];
+    const PlayerSnapshot& b = s_snapshot[j];
+
+    float dx = b.eye[0] - a.eye[0];
+    float dy = b.eye[1] - a.eye[1];
+    float dz = b.eye[2] - a.eye[2];
+    float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+    if (s_config.max_distance > 0.0f && dist > s_config.max_distance) return;
+
+    bool aSeesB = InViewCone(a, b, dist);
+    bool bSeesA = InViewCone(b, a, dist);
+    // Teammates are never filtered, so only enemy pairs need a transmit answer
+    bool transmit = s_config.transmit_hide_enemies && a.team != b.team;
+    if (!aSeesB && !bSeesA && !transmit) return;
+
+    void* ignore = EntitySystem_GetEntityByHandle(a.pawnHandle);
+    bool visible = HasLineOfSight(a.eye, b.eye, ignore);
+    if (visible) {
+        if (aSeesB) s_building[i] |= 1ull << j;
+        if (bSeesA) s_building[j] |= 1ull << i;
+    }
+    if (transmit && (visible || HasPredictedLineOfSight(a, b, ignore))) {
+        s_buildingTransmit[i] |= 1ull << j;
+        s_buildingTransmit[j] |= 1ull << i;
+    }
+}
+
+static void Publish() {
+    uint64_t active = 0;
+    for (int i = 0; i < kMaxSlots; i++) {
+        s_published[i] = s_building[i];
+        s_publishedTransmitPrev[i] = s_publishedTransmit[i];
+        s_publishedTransmit[i] = s_buildingTransmit[i];
+        s_publishedTeam[i] = s_snapshot[i].team;
+        s_publishedPawn[i] = s_snapshot[i].active ? s_snapshot[i].pawnIndex : 0;
+        if (s_snapshot[i].active) active |= 1ull << i;
+    }
+    s_publishedActive = active;
+    s_generation++;
+    s_lastSweepTicks = s_sweepTicks;
+    s_sweeping = false;
+}
+
+void VisibilityManager_OnGameFrame() {
+    if (s_config.interval_ticks <= 0 || !VisibilityManager_IsAvailable()) return;
+
+    if (!s_sweeping) {
+        if (++s_ticksSinceSweep < s_config.interval_ticks) return;
+        s_ticksSinceSweep = 0;
+        BeginSweep();
+    }
+    s_sweepTicks++;
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(s_config.budget_us);
+    while (s_pairCursor < s_pairs.size()) {
+        const auto& pair = s_pairs[s_pairCursor++];
+        ProcessPair(pair.first, pair.second);
+        if (std::chrono::steady_clock::now() >= deadline) break;
+    }
+
+    if (s_pairCursor >= s_pairs.size()) {
+        Publish();
+    }
+}
+
+int32_t VisibilityManager_GetMatrix(uint64_t* outRows) {
+    if (outRows) {
+        memcpy(outRows, s_published, sizeof(s_published));
+    }
+    return s_generation;
+}
+
+void VisibilityManager_ApplyTransmit(int32_t viewerSlot, uint32_t* transmitWords) {
+    if (!s_config.transmit_hide_enemies || s_generation == 0 || !transmitWords) return;
+    if (viewerSlot < 0 || viewerSlot >= kMaxSlots) return;
+
+    // Dead/spectating viewers are left alone (they watch through someone else's eyes)
+    if (!(s_publishedActive & (1ull << viewerSlot))) return;
+
+    // Hide only enemies that failed the padded test in both of the last two sweeps
+    uint64_t hidden = s_publishedActive & ~(s_publishedTransmit[viewerSlot] | s_publishedTransmitPrev[viewerSlot]);
+    int32_t viewerTeam = s_publishedTeam[viewerSlot];
+    while (hidden) {
+        int j = __builtin_ctzll(hidden);
+        hidden &= hidden - 1;
+        uint32_t pawnIndex = s_publishedPawn[j];
+        if (pawnIndex == 0 || s_publishedTeam[j] == viewerTeam) continue;
+        transmitWords[pawnIndex >> 5] &= ~(1u << (pawnIndex & 31));
+    }
+}
+
+void VisibilityManager_OnEntityDeleted(uint32_t index) {
+    if (index == 0) return;
+    for (int i = 0; i < kMaxSlots; i++) {
+        if (s_publishedPawn[i] == index) s_publishedPawn[i] = 0;
+    }
+}
+
+void VisibilityManager_OnMapEnd() {
+    // The snapshot holds pawn pointers of the previous map
+    s_sweeping = false;
+    s_pairs.clear();
+    s_pairCursor = 0;
+    for (int i = 0; i < kMaxSlots; i++) s_snapshot[i].active = false;
+
+    memset(s_publishedTransmit, 0, sizeof(s_publishedTransmit));
+    memset(s_publishedTransmitPrev, 0, sizeof(s_publishedTransmitPrev));
+    memset(s_publishedPawn, 0, sizeof(s_publishedPawn));
+    s_publishedActive = 0;
+}
+
+} // namespace gostrike
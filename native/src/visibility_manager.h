@@ -0,0 +1,43 @@
+// visibility_manager.h - Player-to-player line-of-sight matrix
+// Sweeps all player pairs natively (distance cull -> frustum cull -> traces),
+// spreading the traces across ticks under a time budget, and publishes a
+// 64x64 visibility bitmask that Go and the transmit filter read directly.
+
+#ifndef GOSTRIKE_VISIBILITY_MANAGER_H
+#define GOSTRIKE_VISIBILITY_MANAGER_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Reset state (sweeps stay disabled until configured)
+void VisibilityManager_Initialize();
+
+// Replace the sweep configuration
+void VisibilityManager_Configure(const gs_visibility_config_t* config);
+
+// Whether sweeps can run (engine traces resolved); otherwise nothing is published
+bool VisibilityManager_IsAvailable();
+
+// Advance the current sweep within the per-tick budget (call once per GameFrame)
+void VisibilityManager_OnGameFrame();
+
+// Copy the last published matrix into out_rows[64]. Returns its generation (0 = none yet).
+int32_t VisibilityManager_GetMatrix(uint64_t* outRows);
+
+// Clear enemy pawns the viewer cannot see from a CBitVec<16384> transmit word array.
+// Uses the padded distance + LOS mask, never the view cone
+// (no-op unless transmit_hide_enemies is configured)
+void VisibilityManager_ApplyTransmit(int32_t viewerSlot, uint32_t* transmitWords);
+
+// Abandon the current sweep and forget every published pawn index (map end).
+// The configuration and the last matrix are kept.
+void VisibilityManager_OnMapEnd();
+
+// Forget a deleted pawn so its index is never filtered after reuse
+void VisibilityManager_OnEntityDeleted(uint32_t index);
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_VISIBILITY_MANAGER_H
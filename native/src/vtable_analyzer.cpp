@@ -0,0 +1,161 @@
+// vtable_analyzer.cpp - RTTI-based vtable discovery and gamedata offset validation
+//
+// Itanium ABI layout relied on here:
+//   typeinfo name:  "<len><ClassName>\0" in .rodata
+//   typeinfo:       { vptr, const char* name, ... }
+//   vtable:         { ptrdiff_t offset_to_top, const typeinfo* rtti, fn0, fn1, ... }
+// The primary vtable is the one whose offset_to_top is 0.
+
+#include "vtable_analyzer.h"
+#include "gameconfig.h"
+#include "memory_module.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+namespace gostrike {
+
+static std::unordered_map<std::string, void**> s_vtables; // "module:class" -> first slot
+
+// Find an aligned pointer-sized value equal to target in the module's data
+static uintptr_t* FindPointer(Module* module, uintptr_t target, uintptr_t* from) {
+    for (const auto& seg : module->GetSegments()) {
+        if (seg.executable) continue;
+        auto* p = reinterpret_cast<uintptr_t*>(
+            (reinterpret_cast<uintptr_t>(seg.start) + sizeof(uintptr_t) - 1) & ~(sizeof(uintptr_t) - 1));
+        auto* end = reinterpret_cast<uintptr_t*>(seg.start + seg.size) - 1;
+        if (from && from >= p && from <= end) p = from;
+        else if (from && from > end) continue;
+        for (; p <= end; p++) {
+            if (*p == target) return p;
+        }
+    }
+    return nullptr;
+}
+
+// Find the NUL-terminated typeinfo name string in the module's read-only data
+static const char* FindTypeName(Module* module, const std::string& mangled) {
+    size_t len = mangled.size() + 1; // Include the terminator
+    for (const auto& seg : module->GetSegments()) {
+        if (seg.executable || seg.writable || seg.size < len) continue;
+        const uint8_t* p = seg.start;
+        const uint8_t* end = seg.start + seg.size - len;
+        while (p <= end) {
+            auto* hit = static_cast<const uint8_t*>(memchr(p, mangled[0], end - p + 1));
+            if (!hit) break;
+            // Must start a string: previous byte is a terminator
+            if ((hit == seg.start || hit[-1] == '\0') && memcmp(hit, mangled.c_str(), len) == 0) {
+                return reinterpret_cast<const char*>(hit);
+            }
+            p = hit + 1;
+        }
+    }
+    return nullptr;
+}
+
+static void** FindByRTTI(Module* module, const std::string& mangled) {
+    const char* name = FindTypeName(module, mangled);
+    if (!name) return nullptr;
+
+    // typeinfo.name points at the string; the typeinfo starts one pointer earlier
+    uintptr_t* nameRef = FindPointer(module, reinterpret_cast<uintptr_t>(name), nullptr);
+    while (nameRef) {
+        uintptr_t typeinfo = reinterpret_cast<uintptr_t>(nameRef - 1);
+
+        // Every vtable of the class references the typeinfo; take the primary one
+        uintptr_t* rttiRef = FindPointer(module, typeinfo, nullptr);
+        while (rttiRef) {
+            if (rttiRef[-1] == 0 && module->IsCode(reinterpret_cast<void*>(rttiRef[1]))) {
+                return reinterpret_cast<void**>(rttiRef + 1);
+            }
+            rttiRef = FindPointer(module, typeinfo, rttiRef + 1);
+        }
+        nameRef = FindPointer(module, reinterpret_cast<uintptr_t>(name), nameRef + 1);
+    }
+    return nullptr;
+}
+
+void** VTable_Find(Module* module, const char* className) {
+    if (!module || !module->IsInitialized() || !className || !className[0]) return nullptr;
+
+    std::string key = std::string(module->GetName()) + ":" + className;
+    auto it = s_vtables.find(key);
+    if (it != s_vtables.end()) return it->second;
+
+    std::string mangled = std::to_string(strlen(className)) + className;
+    void** vtable = nullptr;
+
+    // The vtable symbol is the cheap path; RTTI covers stripped/hidden vtables
+    void* symbol = module->FindSymbol(("_ZTV" + mangled).c_str());
+    if (symbol) {
+        vtable = reinterpret_cast<void**>(symbol) + 2;
+    } else {
+        vtable = FindByRTTI(module, mangled);
+    }
+
+    if (vtable) {
+        printf("[GoStrike] VTable: %s -> %p (%s)\n", className, static_cast<void*>(vtable),
+               symbol ? "symbol" : "rtti");
+    } else {
+        printf("[GoStrike] VTable: %s not found in %s\n", className, module->GetName());
+    }
+    s_vtables[key] = vtable;
+    return vtable;
+}
+
+int VTable_Size(Module* module, void** vtable) {
+    if (!module || !vtable) return 0;
+    int n = 0;
+    while (module->IsCode(vtable[n])) n++;
+    return n;
+}
+
+int VTable_FindIndex(Module* module, const char* className, const char* prologue) {
+    void** vtable = VTable_Find(module, className);
+    if (!vtable || !prologue) return -1;
+
+    int size = VTable_Size(module, vtable);
+    for (int i = 0; i < size; i++) {
+        if (module->MatchesSignature(vtable[i], prologue)) return i;
+    }
+    return -1;
+}
+
+int VTable_ValidateGameData() {
+    int failed = 0, checked = 0;
+
+    for (const auto& [name, className] : g_gameConfig.GetVTableClasses()) {
+        Module* module = g_gameConfig.GetModule(name);
+        if (!module) module = &modules::server;
+
+        int index = g_gameConfig.GetOffset(name);
+        void** vtable = VTable_Find(module, className.c_str());
+        if (!vtable || index < 0) {
+            failed++;
+            continue;
+        }
+        checked++;
+
+        int size = VTable_Size(module, vtable);
+        const char* prologue = g_gameConfig.GetPrologue(name);
+        bool ok = index < size && (!prologue || module->MatchesSignature(vtable[index], prologue));
+        if (ok) continue;
+
+        int found = prologue ? VTable_FindIndex(module, className.c_str(), prologue) : -1;
+        if (found >= 0) {
+            printf("[GoStrike] VTable: %s index %d is stale, using %d\n", name.c_str(), index, found);
+            g_gameConfig.SetOffset(name, found);
+        } else {
+            printf("[GoStrike] WARNING: VTable: %s index %d does not match %s (%d slots)\n",
+                   name.c_str(), index, className.c_str(), size);
+            failed++;
+        }
+    }
+
+    printf("[GoStrike] VTable: validated %d gamedata offsets, %d unresolved\n", checked, failed);
+    return failed;
+}
+
+} // namespace gostrike
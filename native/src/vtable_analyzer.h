@@ -0,0 +1,33 @@
+// vtable_analyzer.h - RTTI-based vtable discovery and gamedata offset validation
+// Locates a class's vtable through its _ZTV symbol, or failing that through the
+// Itanium RTTI layout (typeinfo name -> typeinfo -> vtable), then validates or
+// rediscovers gamedata vtable indices by matching function prologues.
+
+#ifndef GOSTRIKE_VTABLE_ANALYZER_H
+#define GOSTRIKE_VTABLE_ANALYZER_H
+
+#include <cstdint>
+
+namespace gostrike {
+
+class Module;
+
+// Find the primary vtable of a class (plain, unnamespaced class names only).
+// Returns the address of the first virtual function slot, or nullptr. Cached.
+void** VTable_Find(Module* module, const char* className);
+
+// Number of leading vtable slots that point into the module's code
+int VTable_Size(Module* module, void** vtable);
+
+// Index of the first vtable function whose prologue matches the signature, or -1
+int VTable_FindIndex(Module* module, const char* className, const char* prologue);
+
+// Check every gamedata offset that names a vtable class: the index must be a
+// function slot of that vtable, and match its prologue if one is given.
+// Mismatches are rediscovered from the prologue when possible.
+// Returns the number of offsets that could not be validated.
+int VTable_ValidateGameData();
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_VTABLE_ANALYZER_H
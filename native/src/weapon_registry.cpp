@@ -0,0 +1,225 @@
+// weapon_registry.cpp - Weapon/item definition registry
+// Item definition indices follow CounterStrikeSharp's ItemDefinition enum.
+// Weapon data lookup follows CounterStrikeSharp's GetCSWeaponDataFromKey usage:
+//   CCSWeaponBaseVData* GetCSWeaponDataFromKey(int, const char* itemDefIndexString)
+
+#include "weapon_registry.h"
+#include "gameconfig.h"
+#include "game_functions.h"
+#include "player_manager.h"
+#include "schema.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace gostrike {
+
+struct ItemDef {
+    int32_t defIndex;
+    const char* classname;
+};
+
+// Registry order defines item IDs; append new items at the end
+static const ItemDef kItemDefs[] = {
+    {1, "weapon_deagle"},
+    {2, "weapon_elite"},
+    {3, "weapon_fiveseven"},
+    {4, "weapon_glock"},
+    {7, "weapon_ak47"},
+    {8, "weapon_aug"},
+    {9, "weapon_awp"},
+    {10, "weapon_famas"},
+    {11, "weapon_g3sg1"},
+    {13, "weapon_galilar"},
+    {14, "weapon_m249"},
+    {16, "weapon_m4a1"},
+    {17, "weapon_mac10"},
+    {19, "weapon_p90"},
+    {23, "weapon_mp5sd"},
+    {24, "weapon_ump45"},
+    {25, "weapon_xm1014"},
+    {26, "weapon_bizon"},
+    {27, "weapon_mag7"},
+    {28, "weapon_negev"},
+    {29, "weapon_sawedoff"},
+    {30, "weapon_tec9"},
+    {31, "weapon_taser"},
+    {32, "weapon_hkp2000"},
+    {33, "weapon_mp7"},
+    {34, "weapon_mp9"},
+    {35, "weapon_nova"},
+    {36, "weapon_p250"},
+    {38, "weapon_scar20"},
+    {39, "weapon_sg556"},
+    {40, "weapon_ssg08"},
+    {42, "weapon_knife"},
+    {43, "weapon_flashbang"},
+    {44, "weapon_hegrenade"},
+    {45, "weapon_smokegrenade"},
+    {46, "weapon_molotov"},
+    {47, "weapon_decoy"},
+    {48, "weapon_incgrenade"},
+    {49, "weapon_c4"},
+    {50, "item_kevlar"},
+    {51, "item_assaultsuit"},
+    {52, "item_heavyassaultsuit"},
+    {55, "item_defuser"},
+    {57, "weapon_healthshot"},
+    {59, "weapon_knife_t"},
+    {60, "weapon_m4a1_silencer"},
+    {61, "weapon_usp_silencer"},
+    {63, "weapon_cz75a"},
+    {64, "weapon_revolver"},
+    {68, "weapon_tagrenade"},
+};
+
+static constexpr int32_t kItemCount = static_cast<int32_t>(sizeof(kItemDefs) / sizeof(kItemDefs[0]));
+
+// Both "weapon_ak47" and "ak47" map to the same ID
+static std::unordered_map<std::string_view, int32_t> s_byName;
+static std::unordered_map<int32_t, int32_t> s_byDefIndex;
+
+struct WeaponData {
+    bool resolved;
+    gs_weapon_info_t info;
+};
+
+static WeaponData s_data[kItemCount];
+
+#ifndef USE_STUB_SDK
+typedef void* (*GetCSWeaponDataFromKeyFn)(int, const char*);
+static GetCSWeaponDataFromKeyFn s_fnGetWeaponData = nullptr;
+
+static int32_t ReadInt(void* base, const char* className, const char* fieldName) {
+    auto key = schema::GetOffset(className, fieldName);
+    if (!base || key.offset <= 0) return 0;
+    return *reinterpret_cast<int32_t*>(reinterpret_cast<uintptr_t>(base) + key.offset);
+}
+#endif
+
+void WeaponRegistry_Initialize() {
+    s_byName.clear();
+    s_byDefIndex.clear();
+    s_byName.reserve(kItemCount * 2);
+
+    for (int32_t id = 0; id < kItemCount; id++) {
+        std::string_view name(kItemDefs[id].classname);
+        s_byName[name] = id;
+        if (name.substr(0, 7) == "weapon_") {
+            s_byName[name.substr(7)] = id;
+        }
+        s_byDefIndex[kItemDefs[id].defIndex] = id;
+        s_data[id].resolved = false;
+    }
+
+#ifndef USE_STUB_SDK
+    s_fnGetWeaponData = reinterpret_cast<GetCSWeaponDataFromKeyFn>(
+        g_gameConfig.ResolveSignature("GetCSWeaponDataFromKey"));
+    printf("[GoStrike] WeaponRegistry: %d items (weaponData=%p)\n", kItemCount, (void*)s_fnGetWeaponData);
+#else
+    printf("[GoStrike] WeaponRegistry: %d items (stub mode, no weapon data)\n", kItemCount);
+#endif
+}
+
+int32_t WeaponRegistry_Count() {
+    return kItemCount;
+}
+
+int32_t WeaponRegistry_Lookup(const char* name) {
+    if (!name) return GS_ITEM_INVALID;
+    auto it = s_byName.find(std::string_view(name));
+    return it != s_byName.end() ? it->second : GS_ITEM_INVALID;
+}
+
+int32_t WeaponRegistry_FindByDefIndex(int32_t defIndex) {
+    auto it = s_byDefIndex.find(defIndex);
+    return it != s_byDefIndex.end() ? it->second : GS_ITEM_INVALID;
+}
+
+const char* WeaponRegistry_GetClassname(int32_t id) {
+    if (id < 0 || id >= kItemCount) return nullptr;
+    return kItemDefs[id].classname;
+}
+
+static void ResolveData(int32_t id) {
+    WeaponData& d = s_data[id];
+    memset(&d.info, 0, sizeof(d.info));
+    d.info.item_id = id;
+    d.info.def_index = kItemDefs[id].defIndex;
+    d.info.classname = kItemDefs[id].classname;
+
+#ifndef USE_STUB_SDK
+    if (s_fnGetWeaponData) {
+        std::string key = std::to_string(kItemDefs[id].defIndex);
+        void* vdata = s_fnGetWeaponData(-1, key.c_str());
+        if (vdata) {
+            d.info.vdata = vdata;
+            d.info.price = ReadInt(vdata, "CCSWeaponBaseVData", "m_nPrice");
+            d.info.kill_award = ReadInt(vdata, "CCSWeaponBaseVData", "m_nKillAward");
+            d.info.max_clip1 = ReadInt(vdata, "CBasePlayerWeaponVData", "m_iMaxClip1");
+            d.info.reserve_ammo = ReadInt(vdata, "CCSWeaponBaseVData", "m_nPrimaryReserveAmmoMax");
+            d.info.gear_slot = ReadInt(vdata, "CCSWeaponBaseVData", "m_GearSlot");
+            d.info.weapon_type = ReadInt(vdata, "CCSWeaponBaseVData", "m_WeaponType");
+        }
+    }
+#endif
+    // One attempt per map: a miss (item schema not loaded yet, or equipment,
+    // which has no weapon data) is cached until WeaponRegistry_OnMapStart
+    d.resolved = true;
+}
+
+void WeaponRegistry_OnMapStart() {
+#ifndef USE_STUB_SDK
+    if (!s_fnGetWeaponData) return;
+    for (int32_t id = 0; id < kItemCount; id++) {
+        WeaponData& d = s_data[id];
+        if (d.resolved && !d.info.vdata && strncmp(kItemDefs[id].classname, "item_", 5) != 0) {
+            d.resolved = false;
+        }
+    }
+#endif
+}
+
+bool WeaponRegistry_GetInfo(int32_t id, gs_weapon_info_t* out) {
+    if (!out || id < 0 || id >= kItemCount) return false;
+    if (!s_data[id].resolved) ResolveData(id);
+    *out = s_data[id].info;
+    return true;
+}
+
+int32_t WeaponRegistry_List(gs_weapon_info_t* out, int32_t max) {
+    if (!out || max <= 0) return 0;
+    int32_t n = max < kItemCount ? max : kItemCount;
+    for (int32_t id = 0; id < n; id++) {
+        WeaponRegistry_GetInfo(id, &out[id]);
+    }
+    return n;
+}
+
+int32_t WeaponRegistry_GiveItems(int32_t slot, const int32_t* ids, int32_t count) {
+#ifndef USE_STUB_SDK
+    if (!ids || count <= 0) return 0;
+
+    void* itemServices = GameFunc_GetItemServices(PlayerManager_GetPawn(slot));
+    if (!itemServices) return 0;
+
+    int32_t given = 0;
+    for (int32_t i = 0; i < count; i++) {
+        const char* classname = WeaponRegistry_GetClassname(ids[i]);
+        if (classname && GameFunc_GiveNamedItemServices(itemServices, classname)) {
+            given++;
+        }
+    }
+    return given;
+#else
+    (void)slot;
+    (void)ids;
+    (void)count;
+    return 0;
+#endif
+}
+
+} // namespace gostrike
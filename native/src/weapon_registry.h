@@ -0,0 +1,45 @@
+// weapon_registry.h - Weapon/item definition registry
+// Maps item names to compact item IDs and item definition indices, and caches
+// CCSWeaponBaseVData pointers from GetCSWeaponDataFromKey.
+
+#ifndef GOSTRIKE_WEAPON_REGISTRY_H
+#define GOSTRIKE_WEAPON_REGISTRY_H
+
+#include "gostrike_abi.h"
+#include <cstdint>
+
+namespace gostrike {
+
+// Build the name/ID tables and resolve GetCSWeaponDataFromKey from gamedata
+void WeaponRegistry_Initialize();
+
+// Number of registered items; valid item IDs are [0, count)
+int32_t WeaponRegistry_Count();
+
+// Item ID for a name ("ak47", "weapon_ak47", "item_kevlar"), GS_ITEM_INVALID if unknown
+int32_t WeaponRegistry_Lookup(const char* name);
+
+// Item ID for an item definition index, GS_ITEM_INVALID if unknown
+int32_t WeaponRegistry_FindByDefIndex(int32_t defIndex);
+
+// Full classname ("weapon_ak47"), nullptr for an invalid ID
+const char* WeaponRegistry_GetClassname(int32_t id);
+
+// Retry weapon data for weapons whose lookup missed (item schema not loaded yet)
+void WeaponRegistry_OnMapStart();
+
+// Fill out with the item's definition and weapon data.
+// Weapon data is read on first use and cached, misses included, until the next
+// map start. Returns false for an invalid ID.
+bool WeaponRegistry_GetInfo(int32_t id, gs_weapon_info_t* out);
+
+// Copy up to max entries into out. Returns the number written.
+int32_t WeaponRegistry_List(gs_weapon_info_t* out, int32_t max);
+
+// Give items by ID, resolving the pawn's item services once (game thread only).
+// Returns the number of items given.
+int32_t WeaponRegistry_GiveItems(int32_t slot, const int32_t* ids, int32_t count);
+
+} // namespace gostrike
+
+#endif // GOSTRIKE_WEAPON_REGISTRY_H
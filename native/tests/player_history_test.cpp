@@ -0,0 +1,148 @@
+// player_history_test.cpp - Sampling edge cases of the player history rings
+
+#include "player_history.h"
+#include "test_common.h"
+
+using namespace gostrike;
+
+static constexpr int32_t kSlot = 3;
+
+// Record a sample whose origin.x and yaw encode the tick
+static void Record(int32_t tick, float yaw = 0.0f) {
+    gs_player_sample_t s = {};
+    s.origin.x = static_cast<float>(tick);
+    s.eye_angles.y = yaw;
+    s.flags = static_cast<uint32_t>(tick);
+    PlayerHistory_RecordSample(kSlot, tick, &s);
+}
+
+static gs_player_sample_t Query(float tick) {
+    gs_player_sample_t out = {};
+    int32_t slot = kSlot;
+    PlayerHistory_Query(&slot, 1, tick, &out);
+    return out;
+}
+
+static void Fresh() {
+    PlayerHistory_Initialize();
+    PlayerHistory_Reset();
+}
+
+TEST(InterpolatesWithinShortGap) {
+    Fresh();
+    Record(10);
+    Record(12);
+
+    gs_player_sample_t s = Query(11.0f);
+    CHECK(s.valid);
+    CHECK(s.slot == kSlot);
+    CHECK_NEAR(s.origin.x, 11.0f, 1e-4f);
+    CHECK(s.flags == 10u);  // flags come from the earlier sample
+}
+
+TEST(InterpolatesAnglesAcrossWrap) {
+    Fresh();
+    Record(10, 350.0f);
+    Record(11, 10.0f);
+
+    gs_player_sample_t s = Query(10.5f);
+    CHECK(s.valid);
+    float yaw = std::fmod(s.eye_angles.y + 360.0f, 360.0f);
+    CHECK(yaw < 1e-3f || yaw > 360.0f - 1e-3f);  // shortest arc passes through 0
+}
+
+TEST(LongGapIsNotInterpolated) {
+    Fresh();
+    Record(10);
+    Record(20);  // dead for 9 ticks
+
+    gs_player_sample_t s = Query(10.5f);
+    CHECK(s.valid);
+    CHECK_NEAR(s.origin.x, 10.0f, 1e-4f);
+
+    CHECK(Query(11.0f).valid);   // one tick past the last sample still holds
+    CHECK(!Query(11.5f).valid);  // inside the gap: no state
+    CHECK(!Query(15.0f).valid);
+    CHECK(!Query(19.9f).valid);
+
+    s = Query(20.0f);
+    CHECK(s.valid);
+    CHECK_NEAR(s.origin.x, 20.0f, 1e-4f);
+}
+
+TEST(GapAtLerpLimitIsInterpolated) {
+    Fresh();
+    Record(10);
+    Record(14);  // exactly kMaxLerpGap
+
+    gs_player_sample_t s = Query(13.0f);
+    CHECK(s.valid);
+    CHECK_NEAR(s.origin.x, 13.0f, 1e-4f);
+}
+
+TEST(NewestSampleHoldsForOneTick) {
+    Fresh();
+    Record(10);
+    Record(11);
+
+    CHECK(Query(11.0f).valid);
+    CHECK(Query(12.0f).valid);
+    CHECK(!Query(12.5f).valid);
+}
+
+TEST(OlderThanHistoryIsInvalid) {
+    Fresh();
+    Record(10);
+    CHECK(!Query(9.5f).valid);
+
+    gs_player_sample_t out = {};
+    int32_t empty = kSlot + 1;
+    CHECK(PlayerHistory_Query(&empty, 1, 10.0f, &out) == 0);
+    CHECK(!out.valid);
+}
+
+TEST(RepeatedTickIsIgnored) {
+    Fresh();
+    Record(10);
+    gs_player_sample_t s = {};
+    s.origin.x = 999.0f;
+    PlayerHistory_RecordSample(kSlot, 10, &s);
+
+    CHECK_NEAR(Query(10.0f).origin.x, 10.0f, 1e-4f);
+}
+
+TEST(RingKeepsNewestTicks) {
+    Fresh();
+    for (int32_t tick = 1; tick <= GS_HISTORY_TICKS + 50; tick++) Record(tick);
+
+    int32_t oldest = 51;
+    CHECK(!Query(static_cast<float>(oldest) - 0.5f).valid);
+    gs_player_sample_t s = Query(static_cast<float>(oldest));
+    CHECK(s.valid);
+    CHECK_NEAR(s.origin.x, static_cast<float>(oldest), 1e-4f);
+    s = Query(100.25f);
+    CHECK(s.valid);
+    CHECK_NEAR(s.origin.x, 100.25f, 1e-3f);
+}
+
+TEST(ClearSlotForgetsHistory) {
+    Fresh();
+    Record(10);
+    PlayerHistory_ClearSlot(kSlot);
+    CHECK(!Query(10.0f).valid);
+
+    Record(5);  // a new player may start at any tick
+    CHECK(Query(5.0f).valid);
+}
+
+TEST(InvalidSlotsAreRejected) {
+    Fresh();
+    int32_t slots[] = {-1, 64};
+    gs_player_sample_t out[2] = {};
+    CHECK(PlayerHistory_Query(slots, 2, 0.0f, out) == 0);
+    CHECK(!out[0].valid && !out[1].valid);
+}
+
+int main() {
+    return gostrike_test::RunTests();
+}
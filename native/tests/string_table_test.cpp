@@ -0,0 +1,69 @@
+// string_table_test.cpp - Interning, lookup and restart of the string table
+
+#include "string_table.h"
+#include "test_common.h"
+
+#include <cstring>
+#include <string>
+
+using namespace gostrike;
+
+TEST(InternReturnsSameIdForSameContent) {
+    StringTable_Shutdown();
+    uint32_t a = StringTable_Intern("player_death");
+    std::string copy = "player_death";
+    uint32_t b = StringTable_Intern(copy.c_str());
+    uint32_t c = StringTable_Intern("round_start");
+
+    CHECK(a != 0);
+    CHECK(a == b);
+    CHECK(c != a);
+    CHECK(std::strcmp(StringTable_Get(a), "player_death") == 0);
+    CHECK(std::strcmp(StringTable_Get(c), "round_start") == 0);
+}
+
+TEST(NullAndEmptyAreZero) {
+    StringTable_Shutdown();
+    CHECK(StringTable_Intern(nullptr) == 0);
+    CHECK(StringTable_Intern("") == 0);
+    CHECK(StringTable_Get(0) == nullptr);
+}
+
+TEST(UnknownIdIsNull) {
+    StringTable_Shutdown();
+    uint32_t id = StringTable_Intern("prop_physics");
+    CHECK(StringTable_Get(id + 1) == nullptr);
+    CHECK(StringTable_Get(0xFFFFFFFFu) == nullptr);
+}
+
+TEST(PointersStableAcrossGrowth) {
+    StringTable_Shutdown();
+    uint32_t first = StringTable_Intern("weapon_ak47");
+    const char* ptr = StringTable_Get(first);
+
+    for (int i = 0; i < 5000; i++) {
+        std::string name = "entity_" + std::to_string(i);
+        StringTable_Intern(name.c_str());
+    }
+
+    CHECK(StringTable_Get(first) == ptr);
+    CHECK(std::strcmp(ptr, "weapon_ak47") == 0);
+    CHECK(StringTable_Intern("weapon_ak47") == first);
+}
+
+TEST(ShutdownRestartsIds) {
+    StringTable_Shutdown();
+    uint32_t before = StringTable_Intern("info_target");
+    StringTable_Intern("func_button");
+    StringTable_Shutdown();
+
+    CHECK(StringTable_Get(before) == nullptr);
+    // IDs are reused after a restart, which is why Go drops its cache at init
+    uint32_t after = StringTable_Intern("func_button");
+    CHECK(after == before);
+    CHECK(std::strcmp(StringTable_Get(after), "func_button") == 0);
+}
+
+int main() {
+    return gostrike_test::RunTests();
+}
@@ -0,0 +1,60 @@
+// test_common.h - Minimal check macros for the native unit tests
+// Each test binary registers its cases with TEST() and runs them from
+// RunTests(); a failed CHECK reports the expression and fails the binary.
+
+#ifndef GOSTRIKE_TEST_COMMON_H
+#define GOSTRIKE_TEST_COMMON_H
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace gostrike_test {
+
+struct TestCase {
+    const char* name;
+    void (*fn)();
+};
+
+inline std::vector<TestCase>& Registry() {
+    static std::vector<TestCase> tests;
+    return tests;
+}
+
+inline int& Failures() {
+    static int failures = 0;
+    return failures;
+}
+
+struct Registrar {
+    Registrar(const char* name, void (*fn)()) { Registry().push_back({name, fn}); }
+};
+
+inline int RunTests() {
+    for (const TestCase& t : Registry()) {
+        int before = Failures();
+        t.fn();
+        printf("%s %s\n", Failures() == before ? "[ OK ]" : "[FAIL]", t.name);
+    }
+    printf("%zu tests, %d failed checks\n", Registry().size(), Failures());
+    return Failures() == 0 ? 0 : 1;
+}
+
+} // namespace gostrike_test
+
+#define TEST(name)                                                        \
+    static void name();                                                   \
+    static gostrike_test::Registrar name##_registrar(#name, name);        \
+    static void name()
+
+#define CHECK(expr)                                                       \
+    do {                                                                  \
+        if (!(expr)) {                                                    \
+            printf("  %s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            gostrike_test::Failures()++;                                  \
+        }                                                                 \
+    } while (0)
+
+#define CHECK_NEAR(a, b, eps) CHECK(std::fabs((a) - (b)) <= (eps))
+
+#endif // GOSTRIKE_TEST_COMMON_H
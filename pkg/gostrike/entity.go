@@ -7,6 +7,7 @@ import (
 
 	"github.com/corrreia/gostrike/internal/bridge"
 	"github.com/corrreia/gostrike/internal/runtime"
+	"github.com/corrreia/gostrike/internal/shared"
 )
 
 // Entity represents a Source 2 entity with schema property access.
@@ -15,6 +16,7 @@ type Entity struct {
 	Index     uint32
 	ClassName string
 	ptr       uintptr // opaque C++ pointer, never dereferenced in Go
+	handle    uint32  // raw CEntityHandle, 0 until known
 }
 
 // Ptr returns the opaque entity pointer for internal use.
@@ -22,6 +24,17 @@ func (e *Entity) Ptr() uintptr {
 	return e.ptr
 }
 
+// Handle returns the entity's raw CEntityHandle (index + serial number).
+// Unlike the index, a handle never resolves to a different entity that reused the slot.
+func (e *Entity) Handle() uint32 {
+	if e.handle == 0 && e.ptr != 0 {
+		if h := bridge.GetEntityHandle(e.ptr); h != bridge.InvalidHandle {
+			e.handle = h
+		}
+	}
+	return e.handle
+}
+
 // IsValid returns true if the entity is still valid in the game.
 func (e *Entity) IsValid() bool {
 	if e.ptr == 0 {
@@ -148,28 +161,113 @@ func GetEntityByIndex(index uint32) *Entity {
 	}
 }
 
-// FindEntitiesByClassName iterates all entity indices and returns
-// entities matching the given classname.
+// FindEntitiesByClassName returns all entities matching the given classname.
+// A trailing '*' matches by prefix, e.g. "weapon_*" returns every weapon.
+// The lookup runs natively in a single call, so it is cheap enough for per-tick use.
 func FindEntitiesByClassName(className string) []*Entity {
-	var entities []*Entity
-	// CS2 max entities is typically 16384
-	for i := uint32(0); i < 16384; i++ {
-		ptr := bridge.GetEntityByIndex(i)
-		if ptr == 0 {
+	return entitiesFromRefs(bridge.FindEntitiesByClassName(className, false))
+}
+
+// FindEntitiesByClassNamePrefix returns all entities whose classname starts with prefix.
+func FindEntitiesByClassNamePrefix(prefix string) []*Entity {
+	return entitiesFromRefs(bridge.FindEntitiesByClassName(prefix, true))
+}
+
+// entitiesFromRefs wraps native entity refs in Entity values
+func entitiesFromRefs(refs []bridge.EntityRef) []*Entity {
+	if len(refs) == 0 {
+		return nil
+	}
+
+	entities := make([]*Entity, len(refs))
+	for i, ref := range refs {
+		entities[i] = &Entity{
+			Index:     ref.Index,
+			ClassName: ref.ClassName,
+			ptr:       ref.Ptr,
+			handle:    ref.Handle,
+		}
+	}
+	return entities
+}
+
+// ============================================================
+// Entity Spawning
+// ============================================================
+
+// SpawnSpec describes an entity to create with SpawnEntities
+type SpawnSpec struct {
+	ClassName string // e.g. "prop_dynamic", "trigger_multiple"
+	Model     string // optional model path
+	Origin    Vector3
+	Angles    Vector3
+	KeyValues map[string]string // extra spawn key-values
+}
+
+// SpawnEntities creates and spawns a batch of entities in a single native call.
+// The returned slice has one entry per spec, nil where the spawn failed.
+// Must be called from the game thread (tick, event, command or timer handlers).
+func SpawnEntities(specs []SpawnSpec) []*Entity {
+	if len(specs) == 0 {
+		return nil
+	}
+
+	bridgeSpecs := make([]bridge.SpawnSpec, len(specs))
+	for i, spec := range specs {
+		bridgeSpecs[i] = bridge.SpawnSpec{
+			ClassName: spec.ClassName,
+			Model:     spec.Model,
+			Origin:    [3]float32{float32(spec.Origin.X), float32(spec.Origin.Y), float32(spec.Origin.Z)},
+			Angles:    [3]float32{float32(spec.Angles.X), float32(spec.Angles.Y), float32(spec.Angles.Z)},
+			KeyValues: spec.KeyValues,
+		}
+	}
+
+	refs := bridge.SpawnEntities(bridgeSpecs)
+	entities := make([]*Entity, len(specs))
+	for i, ref := range refs {
+		if ref.Ptr == 0 || ref.Handle == bridge.InvalidHandle {
 			continue
 		}
-		cn := bridge.GetEntityClassname(ptr)
-		if cn == className {
-			entities = append(entities, &Entity{
-				Index:     i,
-				ClassName: cn,
-				ptr:       ptr,
-			})
+		entities[i] = &Entity{
+			Index:     ref.Index,
+			ClassName: ref.ClassName,
+			ptr:       ref.Ptr,
+			handle:    ref.Handle,
 		}
 	}
 	return entities
 }
 
+// SpawnEntity creates and spawns a single entity. Returns nil on failure.
+func SpawnEntity(spec SpawnSpec) *Entity {
+	entities := SpawnEntities([]SpawnSpec{spec})
+	if len(entities) == 0 {
+		return nil
+	}
+	return entities[0]
+}
+
+// RemoveEntities removes a batch of entities in a single native call.
+// Entities that no longer exist are skipped. Returns the number removed.
+func RemoveEntities(entities []*Entity) int {
+	handles := make([]uint32, 0, len(entities))
+	for _, e := range entities {
+		if e == nil {
+			continue
+		}
+		if h := e.Handle(); h != 0 {
+			handles = append(handles, h)
+		}
+	}
+	return bridge.RemoveEntities(handles)
+}
+
+// Remove deletes this entity from the world.
+func (e *Entity) Remove() bool {
+	return RemoveEntities([]*Entity{e}) == 1
+}
+
 // ============================================================
 // Entity Lifecycle Events
 // ============================================================
@@ -230,8 +328,8 @@ func GetSchemaOffset(className, fieldName string) (offset int32, networked bool)
 // GameData Utility
 // ============================================================
 
-// ResolveGamedata resolves a gamedata entry to a memory address.
-// Returns 0 if not found.
+// ResolveGamedata resolves a gamedata entry to a memory address, applying the
+// entry's "address" steps (offset, rip, read). Returns 0 if not found.
 func ResolveGamedata(name string) uintptr {
 	return bridge.ResolveGamedata(name)
 }
@@ -241,3 +339,161 @@ func ResolveGamedata(name string) uintptr {
 func GetGamedataOffset(name string) int32 {
 	return bridge.GetGamedataOffset(name)
 }
+
+// ============================================================
+// Entity I/O
+// ============================================================
+
+// EntityInput describes one input to fire with FireInputs
+type EntityInput struct {
+	Target    *Entity
+	Input     string  // e.g. "Open", "Toggle", "Enable", "Kill"
+	Value     string  // optional parameter
+	Activator *Entity // optional
+	Caller    *Entity // optional
+	Delay     float32 // seconds; 0 fires immediately, otherwise queued as an I/O event
+}
+
+// entityHandleOrInvalid returns the entity's handle, or InvalidHandle for nil/unknown entities
+func entityHandleOrInvalid(e *Entity) uint32 {
+	if e == nil {
+		return bridge.InvalidHandle
+	}
+	if h := e.Handle(); h != 0 {
+		return h
+	}
+	return bridge.InvalidHandle
+}
+
+// FireInputs fires a batch of entity inputs in a single native call.
+// Entities that no longer exist are skipped. Returns the number dispatched.
+// Must be called from the game thread (tick, event, command or timer handlers).
+func FireInputs(inputs []EntityInput) int {
+	if len(inputs) == 0 {
+		return 0
+	}
+
+	reqs := make([]bridge.InputRequest, 0, len(inputs))
+	for _, in := range inputs {
+		target := entityHandleOrInvalid(in.Target)
+		if target == bridge.InvalidHandle || in.Input == "" {
+			continue
+		}
+		reqs = append(reqs, bridge.InputRequest{
+			Target:    target,
+			Input:     in.Input,
+			Value:     in.Value,
+			Activator: entityHandleOrInvalid(in.Activator),
+			Caller:    entityHandleOrInvalid(in.Caller),
+			Delay:     in.Delay,
+		})
+	}
+	return bridge.FireInputs(reqs)
+}
+
+// AcceptInput fires an input on this entity immediately (e.g. "Open", "SetHealth" with "50").
+func (e *Entity) AcceptInput(input, value string) bool {
+	return FireInputs([]EntityInput{{Target: e, Input: input, Value: value}}) == 1
+}
+
+// AddIOEvent queues an input on this entity to fire after delay seconds.
+func (e *Entity) AddIOEvent(input, value string, delay float32) bool {
+	return FireInputs([]EntityInput{{Target: e, Input: input, Value: value, Delay: delay}}) == 1
+}
+
+// ============================================================
+// Entity Output and Trigger Touch Hooks
+// ============================================================
+
+// EntityOutputEvent is delivered when a hooked entity output fires
+type EntityOutputEvent struct {
+	Entity    *Entity // entity that fired the output
+	Activator *Entity // nil if none
+	Output    string  // e.g. "OnPressed", "OnStartTouch"
+	Delay     float32 // output delay in seconds
+}
+
+// EntityOutputHandler handles hooked entity outputs
+type EntityOutputHandler func(event *EntityOutputEvent)
+
+// TriggerTouchEvent is delivered when an entity starts or stops touching a hooked trigger
+type TriggerTouchEvent struct {
+	Trigger *Entity
+	Other   *Entity // touching entity
+}
+
+// TriggerTouchHandler handles hooked trigger touches
+type TriggerTouchHandler func(event *TriggerTouchEvent)
+
+func entityFromEventRef(ref shared.EntityEventRef) *Entity {
+	if ref.Ptr == 0 {
+		return nil
+	}
+	return &Entity{
+		Index:     ref.Index,
+		ClassName: ref.ClassName,
+		ptr:       ref.Ptr,
+		handle:    ref.Handle,
+	}
+}
+
+// hookHandle returns the subscription handle for an entity (nil = every entity)
+func hookHandle(e *Entity) (uint32, bool) {
+	if e == nil {
+		return shared.AnyEntity, true
+	}
+	h := e.Handle()
+	return h, h != 0 && h != bridge.InvalidHandle
+}
+
+// HookEntityOutput registers a handler for an entity output.
+// Pass a nil entity to receive the output from every entity.
+// Only hooked (entity, output) pairs are recorded natively; events are
+// delivered in one batch per frame, before tick handlers run.
+// Returns a function that removes the hook, or nil if the arguments are
+// invalid. Hooks on an entity are removed automatically when it is deleted
+// or the map ends.
+func HookEntityOutput(entity *Entity, output string, handler EntityOutputHandler) func() {
+	handle, ok := hookHandle(entity)
+	if !ok || output == "" || handler == nil {
+		return nil
+	}
+
+	return runtime.RegisterEntityEventHandler(shared.EntityEventOutput, handle, output, func(ev *runtime.EntityEvent) {
+		handler(&EntityOutputEvent{
+			Entity:    entityFromEventRef(ev.Entity),
+			Activator: entityFromEventRef(ev.Other),
+			Output:    ev.Output,
+			Delay:     ev.Delay,
+		})
+	})
+}
+
+func hookTriggerTouch(kind int, trigger *Entity, handler TriggerTouchHandler) func() {
+	handle, ok := hookHandle(trigger)
+	if !ok || handler == nil {
+		return nil
+	}
+
+	return runtime.RegisterEntityEventHandler(kind, handle, "", func(ev *runtime.EntityEvent) {
+		handler(&TriggerTouchEvent{
+			Trigger: entityFromEventRef(ev.Entity),
+			Other:   entityFromEventRef(ev.Other),
+		})
+	})
+}
+
+// HookTriggerStartTouch registers a handler for entities entering a trigger.
+// Pass a nil trigger to hook every trigger (expensive on physics-heavy maps).
+// Repeated touches of the same pair within one frame are delivered once.
+// Returns a function that removes the hook, or nil if the arguments are invalid.
+func HookTriggerStartTouch(trigger *Entity, handler TriggerTouchHandler) func() {
+	return hookTriggerTouch(shared.EntityEventStartTouch, trigger, handler)
+}
+
+// HookTriggerEndTouch registers a handler for entities leaving a trigger.
+// Pass a nil trigger to hook every trigger (expensive on physics-heavy maps).
+// Returns a function that removes the hook, or nil if the arguments are invalid.
+func HookTriggerEndTouch(trigger *Entity, handler TriggerTouchHandler) func() {
+	return hookTriggerTouch(shared.EntityEventEndTouch, trigger, handler)
+}
@@ -0,0 +1,139 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides bulk reads of array and CUtlVector schema fields.
+package gostrike
+
+import (
+	"encoding/binary"
+	"fmt"
+	"math"
+
+	"github.com/corrreia/gostrike/internal/bridge"
+)
+
+// GetPropIntArray reads an inline int32 array field (e.g. int32 m_field[length])
+// in one call. length is the declared element count.
+func (e *Entity) GetPropIntArray(className, fieldName string, length int) ([]int32, error) {
+	data, err := e.readArray(className, fieldName, bridge.ArrayFixed, length, 4)
+	if err != nil {
+		return nil, err
+	}
+	return decodeInt32s(data), nil
+}
+
+// GetPropFloatArray reads an inline float32 array field in one call
+func (e *Entity) GetPropFloatArray(className, fieldName string, length int) ([]float32, error) {
+	data, err := e.readArray(className, fieldName, bridge.ArrayFixed, length, 4)
+	if err != nil {
+		return nil, err
+	}
+	out := make([]float32, len(data)/4)
+	for i := range out {
+		out[i] = math.Float32frombits(binary.LittleEndian.Uint32(data[i*4:]))
+	}
+	return out, nil
+}
+
+// GetPropIntVector reads a CUtlVector<int32> field in one call
+func (e *Entity) GetPropIntVector(className, fieldName string) ([]int32, error) {
+	data, err := e.readArray(className, fieldName, bridge.ArrayUtlVector, 0, 4)
+	if err != nil {
+		return nil, err
+	}
+	return decodeInt32s(data), nil
+}
+
+// GetPropHandleVector reads a CUtlVector<CHandle<T>> field and resolves every
+// handle natively, in one call. Stale handles yield nil entries.
+func (e *Entity) GetPropHandleVector(className, fieldName string) ([]*Entity, error) {
+	return e.readHandles(className, fieldName, bridge.ArrayUtlVector, 0)
+}
+
+// GetPropHandleArray reads an inline CHandle<T> array field, see GetPropHandleVector
+func (e *Entity) GetPropHandleArray(className, fieldName string, length int) ([]*Entity, error) {
+	return e.readHandles(className, fieldName, bridge.ArrayFixed, length)
+}
+
+// ReadHandleVector reads a CUtlVector<CHandle<T>> field at the end of the path,
+// for arrays that live on a component:
+//
+//	weapons, _ := gostrike.CompileFieldPath(
+//		"CBasePlayerPawn.m_pWeaponServices->CPlayer_WeaponServices.m_hMyWeapons")
+//	list, err := weapons.ReadHandleVector(pawn)
+func (fp *FieldPath) ReadHandleVector(e *Entity) ([]*Entity, error) {
+	return e.readHandles(fp.path, "", bridge.ArrayUtlVector, 0)
+}
+
+// ReadIntArray reads an inline int32 array field at the end of the path
+func (fp *FieldPath) ReadIntArray(e *Entity, length int) ([]int32, error) {
+	data, err := e.readArray(fp.path, "", bridge.ArrayFixed, length, 4)
+	if err != nil {
+		return nil, err
+	}
+	return decodeInt32s(data), nil
+}
+
+// weaponsPath reaches a pawn's weapon list through its weapon services
+const weaponsPath = "CBasePlayerPawn.m_pWeaponServices->CPlayer_WeaponServices.m_hMyWeapons"
+
+// GetWeapons returns the weapons the player is carrying, resolved in one call.
+// Returns nil if the player has no pawn.
+func (p *Player) GetWeapons() []*Entity {
+	pawn := p.GetPawn()
+	if pawn == nil {
+		return nil
+	}
+	weapons, err := pawn.readHandles(weaponsPath, "", bridge.ArrayUtlVector, 0)
+	if err != nil {
+		return nil
+	}
+	out := weapons[:0]
+	for _, w := range weapons {
+		if w != nil {
+			out = append(out, w)
+		}
+	}
+	return out
+}
+
+func (e *Entity) readArray(className, fieldName string, kind int32, length, elemSize int) ([]byte, error) {
+	if e == nil || e.ptr == 0 {
+		return nil, fmt.Errorf("entity pointer is nil")
+	}
+	data, ok := bridge.EntityReadArray(e.ptr, className, fieldName, kind, int32(length), elemSize)
+	if !ok {
+		return nil, fmt.Errorf("array field %s %s: not found", className, fieldName)
+	}
+	return data, nil
+}
+
+func (e *Entity) readHandles(className, fieldName string, kind int32, length int) ([]*Entity, error) {
+	if e == nil || e.ptr == 0 {
+		return nil, fmt.Errorf("entity pointer is nil")
+	}
+	refs, ok := bridge.EntityReadHandles(e.ptr, className, fieldName, kind, int32(length))
+	if !ok {
+		return nil, fmt.Errorf("handle array %s %s: not found", className, fieldName)
+	}
+	out := make([]*Entity, len(refs))
+	for i, ref := range refs {
+		if ref.Ptr == 0 {
+			continue
+		}
+		out[i] = &Entity{
+			Index:     ref.Index,
+			ClassName: ref.ClassName,
+			ptr:       ref.Ptr,
+			handle:    ref.Handle,
+		}
+	}
+	return out, nil
+}
+
+// decodeInt32s decodes consecutive little-endian int32s
+func decodeInt32s(data []byte) []int32 {
+	out := make([]int32, len(data)/4)
+	for i := range out {
+		out[i] = int32(binary.LittleEndian.Uint32(data[i*4:]))
+	}
+	return out
+}
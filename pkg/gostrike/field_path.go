@@ -0,0 +1,106 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides compiled field paths for nested component access.
+package gostrike
+
+import (
+	"encoding/binary"
+	"fmt"
+	"math"
+
+	"github.com/corrreia/gostrike/internal/bridge"
+)
+
+// FieldPath is a chain of schema fields compiled once into native offsets.
+// Steps are "Class.field"; "->" follows the pointer stored in the field:
+//
+//	origin, err := gostrike.CompileFieldPath(
+//		"CBaseEntity.m_CBodyComponent->CBodyComponent.m_pSceneNode->CGameSceneNode.m_vecAbsOrigin")
+//
+// Reads walk the offsets natively with a null check per hop, so nested
+// components cost one call per read, or one call for a whole batch of entities.
+type FieldPath struct {
+	id   int32
+	path string
+}
+
+// CompileFieldPath resolves a field path against the schema. Compile paths at
+// plugin load and reuse them; compiling the same path twice is cheap.
+func CompileFieldPath(path string) (*FieldPath, error) {
+	id := bridge.PathCompile(path)
+	if id < 0 {
+		return nil, fmt.Errorf("field path %q: compile failed (see server console)", path)
+	}
+	return &FieldPath{id: id, path: path}, nil
+}
+
+// String returns the source path
+func (fp *FieldPath) String() string {
+	return fp.path
+}
+
+// ReadRaw reads size bytes (at most 256) at the end of the path for each
+// entity. The result holds len(entities)*size bytes. ok[i] is false when the
+// entity is gone or a pointer along the path is null.
+func (fp *FieldPath) ReadRaw(entities []*Entity, size int) (data []byte, ok []bool) {
+	handles := make([]uint32, len(entities))
+	for i, e := range entities {
+		handles[i] = entityHandleOrInvalid(e)
+	}
+	return bridge.PathRead(fp.id, handles, size)
+}
+
+// ReadInt reads an int32 at the end of the path
+func (fp *FieldPath) ReadInt(e *Entity) (int32, bool) {
+	data, ok := fp.ReadRaw([]*Entity{e}, 4)
+	if len(ok) == 0 || !ok[0] {
+		return 0, false
+	}
+	return int32(binary.LittleEndian.Uint32(data)), true
+}
+
+// ReadFloat reads a float32 at the end of the path
+func (fp *FieldPath) ReadFloat(e *Entity) (float32, bool) {
+	data, ok := fp.ReadRaw([]*Entity{e}, 4)
+	if len(ok) == 0 || !ok[0] {
+		return 0, false
+	}
+	return math.Float32frombits(binary.LittleEndian.Uint32(data)), true
+}
+
+// ReadBool reads a bool at the end of the path
+func (fp *FieldPath) ReadBool(e *Entity) (bool, bool) {
+	data, ok := fp.ReadRaw([]*Entity{e}, 1)
+	if len(ok) == 0 || !ok[0] {
+		return false, false
+	}
+	return data[0] != 0, true
+}
+
+// ReadVector reads a Vector/QAngle at the end of the path
+func (fp *FieldPath) ReadVector(e *Entity) (Vector3, bool) {
+	data, ok := fp.ReadRaw([]*Entity{e}, 12)
+	if len(ok) == 0 || !ok[0] {
+		return Vector3{}, false
+	}
+	return decodeVector3(data), true
+}
+
+// ReadInts reads an int32 for many entities in one native call
+func (fp *FieldPath) ReadInts(entities []*Entity) ([]int32, []bool) {
+	data, ok := fp.ReadRaw(entities, 4)
+	out := make([]int32, len(ok))
+	for i := range out {
+		out[i] = int32(binary.LittleEndian.Uint32(data[i*4:]))
+	}
+	return out, ok
+}
+
+// ReadVectors reads a Vector/QAngle for many entities in one native call
+func (fp *FieldPath) ReadVectors(entities []*Entity) ([]Vector3, []bool) {
+	data, ok := fp.ReadRaw(entities, 12)
+	out := make([]Vector3, len(ok))
+	for i := range out {
+		out[i] = decodeVector3(data[i*12:])
+	}
+	return out, ok
+}
@@ -0,0 +1,94 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides round state from CCSGameRules and round termination.
+package gostrike
+
+import (
+	"github.com/corrreia/gostrike/internal/bridge"
+)
+
+// RoundEndReason is the reason passed to TerminateRound
+type RoundEndReason int32
+
+const (
+	RoundEndTargetBombed         RoundEndReason = 1
+	RoundEndTerroristsEscaped    RoundEndReason = 4
+	RoundEndCTsPreventEscape     RoundEndReason = 5
+	RoundEndEscapersNeutralized  RoundEndReason = 6
+	RoundEndBombDefused          RoundEndReason = 7
+	RoundEndCTsWin               RoundEndReason = 8
+	RoundEndTerroristsWin        RoundEndReason = 9
+	RoundEndDraw                 RoundEndReason = 10
+	RoundEndHostagesRescued      RoundEndReason = 11
+	RoundEndTargetSaved          RoundEndReason = 12
+	RoundEndHostagesNotRescued   RoundEndReason = 13
+	RoundEndTerroristsNotEscaped RoundEndReason = 14
+	RoundEndGameCommencing       RoundEndReason = 16
+	RoundEndTerroristsSurrender  RoundEndReason = 17
+	RoundEndCTsSurrender         RoundEndReason = 18
+)
+
+// GameRules is a snapshot of the round state, taken once per game frame
+type GameRules struct {
+	ptr uintptr
+
+	Warmup         bool
+	FreezePeriod   bool
+	BombPlanted    bool
+	GamePhase      int32
+	RoundsPlayed   int32
+	RoundTime      int32   // seconds
+	RoundStartTime float32 // server time
+	WarmupEnd      float32 // server time
+	WinReason      RoundEndReason
+	ScoreT         int32
+	ScoreCT        int32
+}
+
+// GetGameRules returns the current round state, or nil between maps.
+// Reading it does not touch the game; the snapshot is refreshed every frame.
+func GetGameRules() *GameRules {
+	s := bridge.GetGameRules()
+	if s.GameRules == 0 {
+		return nil
+	}
+	return &GameRules{
+		ptr:            s.GameRules,
+		Warmup:         s.Warmup,
+		FreezePeriod:   s.FreezePeriod,
+		BombPlanted:    s.BombPlanted,
+		GamePhase:      s.GamePhase,
+		RoundsPlayed:   s.RoundsPlayed,
+		RoundTime:      s.RoundTime,
+		RoundStartTime: s.RoundStartTime,
+		WarmupEnd:      s.WarmupEnd,
+		WinReason:      RoundEndReason(s.WinReason),
+		ScoreT:         s.ScoreT,
+		ScoreCT:        s.ScoreCT,
+	}
+}
+
+// Ptr returns the raw CCSGameRules pointer
+func (g *GameRules) Ptr() uintptr {
+	return g.ptr
+}
+
+// GetPropInt reads any other CCSGameRules int32 field via schema
+func (g *GameRules) GetPropInt(fieldName string) int32 {
+	return bridge.EntityGetInt(g.ptr, "CCSGameRules", fieldName)
+}
+
+// GetPropFloat reads a CCSGameRules float32 field via schema
+func (g *GameRules) GetPropFloat(fieldName string) float32 {
+	return bridge.EntityGetFloat(g.ptr, "CCSGameRules", fieldName)
+}
+
+// GetPropBool reads a CCSGameRules bool field via schema
+func (g *GameRules) GetPropBool(fieldName string) bool {
+	return bridge.EntityGetBool(g.ptr, "CCSGameRules", fieldName)
+}
+
+// TerminateRound ends the current round after delay seconds.
+// Returns false if there are no gamerules or the function is missing from gamedata.
+func TerminateRound(delay float32, reason RoundEndReason) bool {
+	return bridge.TerminateRound(delay, int32(reason))
+}
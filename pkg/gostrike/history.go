@@ -0,0 +1,63 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides recent per-player state history recorded natively every tick.
+package gostrike
+
+import (
+	"github.com/corrreia/gostrike/internal/bridge"
+)
+
+// HistoryTicks is the number of ticks of history kept per player
+const HistoryTicks = 128
+
+// PlayerState is a player's recorded state at a tick
+type PlayerState struct {
+	Slot      int
+	Valid     bool // false if nothing was recorded around the tick
+	Origin    Vector3
+	EyeAngles Vector3 // pitch, yaw, roll
+	Velocity  Vector3
+	Flags     uint32 // m_fFlags
+}
+
+// LatestTick returns the newest tick in the history, or -1 if none
+func LatestTick() int32 {
+	return bridge.HistoryLatestTick()
+}
+
+// GetPlayerStatesAt returns the state of every given player at tick, which may
+// be fractional to interpolate between ticks. Only live players are recorded,
+// and only the last HistoryTicks ticks are kept.
+//
+//	// Where everyone was 8 ticks ago
+//	states := gostrike.GetPlayerStatesAt(float32(gostrike.LatestTick()-8), players...)
+func GetPlayerStatesAt(tick float32, players ...*Player) []PlayerState {
+	slots := make([]int32, 0, len(players))
+	for _, p := range players {
+		if p != nil {
+			slots = append(slots, int32(p.Slot))
+		}
+	}
+	samples := bridge.HistoryQuery(slots, tick)
+
+	states := make([]PlayerState, len(samples))
+	for i, s := range samples {
+		states[i] = PlayerState{
+			Slot:      int(s.Slot),
+			Valid:     s.Valid,
+			Origin:    fromBridgeVec(s.Origin),
+			EyeAngles: fromBridgeVec(s.EyeAngles),
+			Velocity:  fromBridgeVec(s.Velocity),
+			Flags:     s.Flags,
+		}
+	}
+	return states
+}
+
+// StateAt returns the player's recorded state at tick
+func (p *Player) StateAt(tick float32) (PlayerState, bool) {
+	states := GetPlayerStatesAt(tick, p)
+	if len(states) == 0 || !states[0].Valid {
+		return PlayerState{}, false
+	}
+	return states[0], true
+}
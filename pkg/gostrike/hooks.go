@@ -0,0 +1,242 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides generic native function hooks driven by gamedata.
+package gostrike
+
+import (
+	"fmt"
+	"math"
+	"sync"
+
+	"github.com/corrreia/gostrike/internal/bridge"
+	"github.com/corrreia/gostrike/internal/runtime"
+)
+
+// HookType declares the type of a hooked function's argument or return value
+type HookType int32
+
+const (
+	HookVoid    HookType = HookType(bridge.HookTypeVoid) // return type only
+	HookInt32   HookType = HookType(bridge.HookTypeInt32)
+	HookInt64   HookType = HookType(bridge.HookTypeInt64)
+	HookPointer HookType = HookType(bridge.HookTypePointer)
+	HookFloat   HookType = HookType(bridge.HookTypeFloat)
+	HookDouble  HookType = HookType(bridge.HookTypeDouble)
+	HookBool    HookType = HookType(bridge.HookTypeBool)
+	HookVector  HookType = HookType(bridge.HookTypeVector) // const Vector& / Vector*
+)
+
+// HookResult tells the native hook chain what a handler did
+type HookResult int
+
+const (
+	HookContinue  HookResult = HookResult(bridge.HookContinue)  // nothing changed
+	HookChanged   HookResult = HookResult(bridge.HookChanged)   // pre: args modified; post: return modified
+	HookSupercede HookResult = HookResult(bridge.HookSupercede) // pre only: skip the original, return SetReturn* value
+)
+
+// FunctionHook is a native detour on a gamedata signature
+type FunctionHook struct {
+	id   int32
+	name string
+	ret  HookType
+	args []HookType
+}
+
+// HookHandler handles one hooked call
+type HookHandler func(call *HookCall) HookResult
+
+var (
+	functionHooks   = make(map[string]*FunctionHook)
+	functionHooksMu sync.Mutex
+)
+
+// DefineHook hooks the function named by a gamedata signature entry.
+// The signature must match the native function: every argument must be passed
+// in registers (at most 6 integer/pointer and 8 float arguments).
+// Hooks defined during plugin load are installed together on the next frame.
+//
+//	postThink, err := gostrike.DefineHook("CCSPlayerPawnBase_PostThink", gostrike.HookVoid, gostrike.HookPointer)
+func DefineHook(name string, ret HookType, args ...HookType) (*FunctionHook, error) {
+	if len(args) > bridge.HookMaxArgs {
+		return nil, fmt.Errorf("hook %s: too many arguments (%d > %d)", name, len(args), bridge.HookMaxArgs)
+	}
+
+	functionHooksMu.Lock()
+	defer functionHooksMu.Unlock()
+
+	if h, ok := functionHooks[name]; ok {
+		if !h.sameSignature(ret, args) {
+			return nil, fmt.Errorf("hook %s: already defined with a different signature", name)
+		}
+		return h, nil
+	}
+
+	rawArgs := make([]int32, len(args))
+	for i, a := range args {
+		rawArgs[i] = int32(a)
+	}
+	id := bridge.HookDefine(name, int32(ret), rawArgs)
+	if id < 0 {
+		return nil, fmt.Errorf("hook %s: native definition failed (see server console)", name)
+	}
+
+	h := &FunctionHook{id: id, name: name, ret: ret, args: append([]HookType(nil), args...)}
+	functionHooks[name] = h
+	return h, nil
+}
+
+func (h *FunctionHook) sameSignature(ret HookType, args []HookType) bool {
+	if h.ret != ret || len(h.args) != len(args) {
+		return false
+	}
+	for i := range args {
+		if h.args[i] != args[i] {
+			return false
+		}
+	}
+	return true
+}
+
+// Name returns the gamedata name of the hooked function
+func (h *FunctionHook) Name() string {
+	return h.name
+}
+
+// Hook adds a handler to the pre (before the original) or post chain.
+// Returns a function that removes the handler; once a chain has no handlers
+// left the native detour stops calling into Go for it.
+func (h *FunctionHook) Hook(mode HookMode, handler HookHandler) func() {
+	return runtime.RegisterHookHandler(int(h.id), mode == HookPost, func(frame *runtime.HookFrame) int {
+		return int(handler(&HookCall{hook: h, frame: frame}))
+	})
+}
+
+// HookCall gives a handler access to one hooked call. It must not be kept
+// after the handler returns.
+type HookCall struct {
+	hook  *FunctionHook
+	frame *runtime.HookFrame
+}
+
+// Hook returns the hook being run
+func (c *HookCall) Hook() *FunctionHook { return c.hook }
+
+// IsPost reports whether the original function has already run
+func (c *HookCall) IsPost() bool { return c.frame.Post }
+
+// Superceded reports whether a pre handler skipped the original
+func (c *HookCall) Superceded() bool { return c.frame.Superceded }
+
+// NumArgs returns the number of declared arguments
+func (c *HookCall) NumArgs() int { return len(c.frame.Args) }
+
+func (c *HookCall) arg(i int) uint64 {
+	if i < 0 || i >= len(c.frame.Args) {
+		return 0
+	}
+	return c.frame.Args[i]
+}
+
+func (c *HookCall) setArg(i int, v uint64) {
+	if i >= 0 && i < len(c.frame.Args) {
+		c.frame.Args[i] = v
+	}
+}
+
+// ArgInt returns an INT32 (or BOOL) argument
+func (c *HookCall) ArgInt(i int) int32 { return int32(c.arg(i)) }
+
+// ArgInt64 returns an INT64 argument
+func (c *HookCall) ArgInt64(i int) int64 { return int64(c.arg(i)) }
+
+// ArgPointer returns a POINTER or VECTOR argument
+func (c *HookCall) ArgPointer(i int) uintptr { return uintptr(c.arg(i)) }
+
+// ArgBool returns a BOOL argument
+func (c *HookCall) ArgBool(i int) bool { return c.arg(i) != 0 }
+
+// ArgFloat returns a FLOAT argument
+func (c *HookCall) ArgFloat(i int) float32 { return math.Float32frombits(uint32(c.arg(i))) }
+
+// ArgDouble returns a DOUBLE argument
+func (c *HookCall) ArgDouble(i int) float64 { return math.Float64frombits(c.arg(i)) }
+
+// ArgVector reads the Vector a VECTOR argument points to
+func (c *HookCall) ArgVector(i int) Vector3 {
+	return fromBridgeVec(bridge.ReadVector(c.ArgPointer(i)))
+}
+
+// ArgEntity returns the entity a POINTER argument points to (nil if none)
+func (c *HookCall) ArgEntity(i int) *Entity {
+	ptr := c.ArgPointer(i)
+	if ptr == 0 {
+		return nil
+	}
+	return GetEntityByIndex(bridge.GetEntityIndex(ptr))
+}
+
+// SetArgInt replaces an INT32 argument (return HookChanged from a pre handler)
+func (c *HookCall) SetArgInt(i int, v int32) { c.setArg(i, uint64(int64(v))) }
+
+// SetArgInt64 replaces an INT64 argument
+func (c *HookCall) SetArgInt64(i int, v int64) { c.setArg(i, uint64(v)) }
+
+// SetArgPointer replaces a POINTER argument
+func (c *HookCall) SetArgPointer(i int, v uintptr) { c.setArg(i, uint64(v)) }
+
+// SetArgBool replaces a BOOL argument
+func (c *HookCall) SetArgBool(i int, v bool) { c.setArg(i, boolBits(v)) }
+
+// SetArgFloat replaces a FLOAT argument
+func (c *HookCall) SetArgFloat(i int, v float32) { c.setArg(i, uint64(math.Float32bits(v))) }
+
+// SetArgDouble replaces a DOUBLE argument
+func (c *HookCall) SetArgDouble(i int, v float64) { c.setArg(i, math.Float64bits(v)) }
+
+// SetArgVector overwrites the Vector a VECTOR argument points to, in place
+func (c *HookCall) SetArgVector(i int, v Vector3) {
+	bridge.WriteVector(c.ArgPointer(i), toBridgeVec(v))
+}
+
+// ReturnInt returns an INT32 return value (post, or after SetReturnInt)
+func (c *HookCall) ReturnInt() int32 { return int32(*c.frame.Ret) }
+
+// ReturnInt64 returns an INT64 return value
+func (c *HookCall) ReturnInt64() int64 { return int64(*c.frame.Ret) }
+
+// ReturnPointer returns a POINTER return value
+func (c *HookCall) ReturnPointer() uintptr { return uintptr(*c.frame.Ret) }
+
+// ReturnBool returns a BOOL return value
+func (c *HookCall) ReturnBool() bool { return *c.frame.Ret&0xFF != 0 }
+
+// ReturnFloat returns a FLOAT return value
+func (c *HookCall) ReturnFloat() float32 { return math.Float32frombits(uint32(*c.frame.Ret)) }
+
+// ReturnDouble returns a DOUBLE return value
+func (c *HookCall) ReturnDouble() float64 { return math.Float64frombits(*c.frame.Ret) }
+
+// SetReturnInt sets an INT32 return value (with HookSupercede, or HookChanged in post)
+func (c *HookCall) SetReturnInt(v int32) { *c.frame.Ret = uint64(int64(v)) }
+
+// SetReturnInt64 sets an INT64 return value
+func (c *HookCall) SetReturnInt64(v int64) { *c.frame.Ret = uint64(v) }
+
+// SetReturnPointer sets a POINTER return value
+func (c *HookCall) SetReturnPointer(v uintptr) { *c.frame.Ret = uint64(v) }
+
+// SetReturnBool sets a BOOL return value
+func (c *HookCall) SetReturnBool(v bool) { *c.frame.Ret = boolBits(v) }
+
+// SetReturnFloat sets a FLOAT return value
+func (c *HookCall) SetReturnFloat(v float32) { *c.frame.Ret = uint64(math.Float32bits(v)) }
+
+// SetReturnDouble sets a DOUBLE return value
+func (c *HookCall) SetReturnDouble(v float64) { *c.frame.Ret = math.Float64bits(v) }
+
+func boolBits(v bool) uint64 {
+	if v {
+		return 1
+	}
+	return 0
+}
@@ -0,0 +1,97 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides per-tick player input capture.
+package gostrike
+
+import (
+	"math/bits"
+
+	"github.com/corrreia/gostrike/internal/runtime"
+)
+
+// InputButtons is a CS2 button mask (InputBitMask_t)
+type InputButtons uint64
+
+const (
+	InputAttack       InputButtons = 1 << 0
+	InputJump         InputButtons = 1 << 1
+	InputDuck         InputButtons = 1 << 2
+	InputForward      InputButtons = 1 << 3
+	InputBack         InputButtons = 1 << 4
+	InputUse          InputButtons = 1 << 5
+	InputTurnLeft     InputButtons = 1 << 7
+	InputTurnRight    InputButtons = 1 << 8
+	InputMoveLeft     InputButtons = 1 << 9
+	InputMoveRight    InputButtons = 1 << 10
+	InputAttack2      InputButtons = 1 << 11
+	InputReload       InputButtons = 1 << 13
+	InputSpeed        InputButtons = 1 << 16 // walk
+	InputScore        InputButtons = 1 << 33
+	InputZoom         InputButtons = 1 << 34
+	InputLookAtWeapon InputButtons = 1 << 35
+)
+
+// Has reports whether every button in b is held
+func (m InputButtons) Has(b InputButtons) bool {
+	return m&b == b
+}
+
+// PlayerInput is one player's input for a tick
+type PlayerInput struct {
+	Slot        int
+	Buttons     InputButtons
+	ViewAngles  Vector3 // pitch, yaw, roll
+	ForwardMove float32
+	LeftMove    float32
+	UpMove      float32
+}
+
+// InputFrame holds the inputs captured since the last server frame.
+// It is only valid for the duration of the handler call.
+type InputFrame struct {
+	raw *runtime.InputFrame
+}
+
+// Frame returns the server frame counter at delivery
+func (f *InputFrame) Frame() int32 {
+	return f.raw.Frame
+}
+
+// Get returns a slot's input, if it was captured this frame
+func (f *InputFrame) Get(slot int) (PlayerInput, bool) {
+	if slot < 0 || slot >= len(f.raw.Buttons) || f.raw.Valid&(1<<uint(slot)) == 0 {
+		return PlayerInput{}, false
+	}
+	m := f.raw.Move[slot]
+	return PlayerInput{
+		Slot:        slot,
+		Buttons:     InputButtons(f.raw.Buttons[slot]),
+		ViewAngles:  fromBridgeVec(f.raw.ViewAngles[slot]),
+		ForwardMove: m[0],
+		LeftMove:    m[1],
+		UpMove:      m[2],
+	}, true
+}
+
+// Each calls fn for every captured slot, in slot order
+func (f *InputFrame) Each(fn func(in PlayerInput)) {
+	for valid := f.raw.Valid; valid != 0; valid &= valid - 1 {
+		in, _ := f.Get(bits.TrailingZeros64(valid))
+		fn(in)
+	}
+}
+
+// InputHandler receives the inputs captured since the last frame
+type InputHandler func(frame *InputFrame)
+
+// RegisterInputHandler receives every player's buttons, view angles and move
+// values once per server frame. Capture starts with the first handler and
+// stops when the last is removed; without handlers the PostThink hook costs
+// nothing. Returns a function that removes the handler.
+//
+// Input is read in PostThink, after the tick's movement and attacks, so it is
+// observe-only: there is no way to rewrite it from here.
+func RegisterInputHandler(handler InputHandler) func() {
+	return runtime.RegisterInputHandler(func(raw *runtime.InputFrame) {
+		handler(&InputFrame{raw: raw})
+	})
+}
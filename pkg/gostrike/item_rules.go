@@ -0,0 +1,104 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides native weapon pickup/buy restrictions.
+package gostrike
+
+import (
+	"github.com/corrreia/gostrike/internal/bridge"
+	"github.com/corrreia/gostrike/internal/runtime"
+)
+
+// AcquireMethod describes how a player is getting an item
+type AcquireMethod int
+
+const (
+	AcquirePickup AcquireMethod = AcquireMethod(bridge.AcquirePickup) // picking up a weapon
+	AcquireBuy    AcquireMethod = AcquireMethod(bridge.AcquireBuy)    // buying from the buy menu
+	AcquireUse    AcquireMethod = AcquireMethod(bridge.AcquireUse)    // touching a dropped weapon
+)
+
+// ItemAcquireEvent is passed to handlers for items marked with EscalateItems
+type ItemAcquireEvent struct {
+	Slot   int
+	Item   ItemID
+	Method AcquireMethod
+}
+
+// GetPlayer returns the acquiring player
+func (e *ItemAcquireEvent) GetPlayer() *Player {
+	info := bridge.GetPlayer(e.Slot)
+	if info == nil {
+		return nil
+	}
+	return playerFromBridgeInfo(info)
+}
+
+// ItemAcquireHandler decides an escalated acquisition.
+// Return EventHandled or EventStop to deny it.
+type ItemAcquireHandler func(event *ItemAcquireEvent) EventResult
+
+func itemIDs(ids []ItemID) []int32 {
+	raw := make([]int32, 0, len(ids))
+	for _, id := range ids {
+		if id != ItemInvalid {
+			raw = append(raw, int32(id))
+		}
+	}
+	return raw
+}
+
+// RestrictItemsForTeam stops a team from picking up or buying the items.
+// Restrictions are enforced natively; plugin gives (GiveWeapon, GiveItems,
+// PlayerBatch) are not affected.
+func RestrictItemsForTeam(team Team, ids ...ItemID) {
+	bridge.ItemRulesSet(bridge.ItemRuleTeamDeny, int32(team), itemIDs(ids), true)
+}
+
+// AllowItemsForTeam lifts RestrictItemsForTeam
+func AllowItemsForTeam(team Team, ids ...ItemID) {
+	bridge.ItemRulesSet(bridge.ItemRuleTeamDeny, int32(team), itemIDs(ids), false)
+}
+
+// RestrictItems stops this player from picking up or buying the items.
+// Player restrictions are dropped when the player disconnects.
+func (p *Player) RestrictItems(ids ...ItemID) {
+	bridge.ItemRulesSet(bridge.ItemRuleSlotDeny, int32(p.Slot), itemIDs(ids), true)
+}
+
+// AllowItems lifts RestrictItems
+func (p *Player) AllowItems(ids ...ItemID) {
+	bridge.ItemRulesSet(bridge.ItemRuleSlotDeny, int32(p.Slot), itemIDs(ids), false)
+}
+
+// SetTeamItemLimit caps how many players of a team may hold an item (-1 = unlimited).
+// The native check compares against the count set with SetTeamItemCount.
+func SetTeamItemLimit(team Team, id ItemID, limit int) {
+	bridge.ItemSetLimit(int32(team), int32(id), int32(limit))
+}
+
+// SetTeamItemCount reports how many players of a team currently hold an item
+func SetTeamItemCount(team Team, id ItemID, count int) {
+	bridge.ItemSetCount(int32(team), int32(id), int32(count))
+}
+
+// EscalateItems routes acquisitions of the items by a team to the
+// RegisterItemAcquireHandler handlers. Use it only for rules that cannot be
+// expressed as restrictions or limits; each check crosses into Go.
+func EscalateItems(team Team, enable bool, ids ...ItemID) {
+	bridge.ItemRulesSet(bridge.ItemRuleEscalate, int32(team), itemIDs(ids), enable)
+}
+
+// ClearItemRestrictions drops every item restriction, limit, count and escalation
+func ClearItemRestrictions() {
+	bridge.ItemRulesClear()
+}
+
+// RegisterItemAcquireHandler registers a handler for escalated item acquisitions
+func RegisterItemAcquireHandler(handler ItemAcquireHandler) {
+	runtime.RegisterItemAcquireHandler(func(slot, itemID, method int) int {
+		return int(handler(&ItemAcquireEvent{
+			Slot:   slot,
+			Item:   ItemID(itemID),
+			Method: AcquireMethod(method),
+		}))
+	})
+}
@@ -0,0 +1,165 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides generic native function calls driven by gamedata.
+package gostrike
+
+import (
+	"fmt"
+	"math"
+
+	"github.com/corrreia/gostrike/internal/bridge"
+)
+
+// NativeFunc is a callable native function. Define it once at plugin load and
+// call it as often as needed; each call is a single native dispatch.
+type NativeFunc struct {
+	id   int32
+	name string
+	ret  HookType
+	args []HookType
+}
+
+// DefineFunction describes the function named by a gamedata signature (or
+// offset) entry. Argument and return types use the HookType codes; every
+// argument must be passed in registers (at most 6 integer/pointer and 8 float
+// arguments) and HookVector is not allowed as a return type.
+//
+//	suicide, err := gostrike.DefineFunction("CBasePlayerPawn_CommitSuicide",
+//		gostrike.HookVoid, gostrike.HookPointer, gostrike.HookBool, gostrike.HookBool)
+func DefineFunction(name string, ret HookType, args ...HookType) (*NativeFunc, error) {
+	return defineNative(name, -1, ret, args)
+}
+
+// DefineVirtual describes the function at a raw vtable index. The first
+// argument must be HookPointer and is the object whose vtable is used.
+func DefineVirtual(index int, ret HookType, args ...HookType) (*NativeFunc, error) {
+	if index < 0 {
+		return nil, fmt.Errorf("vtable index %d: must not be negative", index)
+	}
+	return defineNative("", int32(index), ret, args)
+}
+
+func defineNative(name string, index int32, ret HookType, args []HookType) (*NativeFunc, error) {
+	if len(args) > bridge.HookMaxArgs {
+		return nil, fmt.Errorf("function %s: too many arguments (%d > %d)", name, len(args), bridge.HookMaxArgs)
+	}
+	rawArgs := make([]int32, len(args))
+	for i, a := range args {
+		rawArgs[i] = int32(a)
+	}
+	id := bridge.CallDefine(name, index, int32(ret), rawArgs)
+	if id < 0 {
+		if name == "" {
+			name = fmt.Sprintf("vtable[%d]", index)
+		}
+		return nil, fmt.Errorf("function %s: native definition failed (see server console)", name)
+	}
+	return &NativeFunc{id: id, name: name, ret: ret, args: append([]HookType(nil), args...)}, nil
+}
+
+// Name returns the gamedata name of the function ("" for DefineVirtual)
+func (f *NativeFunc) Name() string {
+	return f.name
+}
+
+// Call invokes the function on the game thread. Each argument must match its
+// declared type: integers for HookInt32/HookInt64, uintptr or *Entity for
+// HookPointer, bool, float32/float64 and Vector3 for HookVector (passed by
+// reference to a temporary copy).
+func (f *NativeFunc) Call(args ...interface{}) (CallValue, error) {
+	if len(args) != len(f.args) {
+		return 0, fmt.Errorf("function %s: expected %d arguments, got %d", f.name, len(f.args), len(args))
+	}
+
+	var packed [bridge.HookMaxArgs]uint64
+	var vectors [][3]float32
+	for i, a := range args {
+		t := f.args[i]
+		if t == HookVector {
+			v, ok := a.(Vector3)
+			if !ok {
+				return 0, fmt.Errorf("function %s: argument %d must be a Vector3", f.name, i)
+			}
+			packed[i] = uint64(len(vectors))
+			vectors = append(vectors, toBridgeVec(v))
+			continue
+		}
+		bits, ok := packNativeArg(t, a)
+		if !ok {
+			return 0, fmt.Errorf("function %s: argument %d has unsupported type %T", f.name, i, a)
+		}
+		packed[i] = bits
+	}
+
+	ret, ok := bridge.CallInvoke(f.id, packed[:len(args)], vectors)
+	if !ok {
+		return 0, fmt.Errorf("function %s: call failed (null object?)", f.name)
+	}
+	return CallValue(ret), nil
+}
+
+func packNativeArg(t HookType, a interface{}) (uint64, bool) {
+	switch t {
+	case HookFloat:
+		switch v := a.(type) {
+		case float32:
+			return uint64(math.Float32bits(v)), true
+		case float64:
+			return uint64(math.Float32bits(float32(v))), true
+		}
+		return 0, false
+	case HookDouble:
+		switch v := a.(type) {
+		case float32:
+			return math.Float64bits(float64(v)), true
+		case float64:
+			return math.Float64bits(v), true
+		}
+		return 0, false
+	}
+
+	switch v := a.(type) {
+	case int:
+		return uint64(int64(v)), true
+	case int32:
+		return uint64(int64(v)), true
+	case int64:
+		return uint64(v), true
+	case uint32:
+		return uint64(v), true
+	case uint64:
+		return v, true
+	case uintptr:
+		return uint64(v), true
+	case bool:
+		return boolBits(v), true
+	case *Entity:
+		if v == nil {
+			return 0, true
+		}
+		return uint64(v.Ptr()), true
+	case nil:
+		return 0, true
+	}
+	return 0, false
+}
+
+// CallValue is the normalized return value of a native call
+type CallValue uint64
+
+// Int returns an INT32 (or BOOL) return value
+func (v CallValue) Int() int32 { return int32(v) }
+
+// Int64 returns an INT64 return value
+func (v CallValue) Int64() int64 { return int64(v) }
+
+// Pointer returns a POINTER return value
+func (v CallValue) Pointer() uintptr { return uintptr(v) }
+
+// Bool returns a BOOL return value
+func (v CallValue) Bool() bool { return v != 0 }
+
+// Float returns a FLOAT return value
+func (v CallValue) Float() float32 { return math.Float32frombits(uint32(v)) }
+
+// Double returns a DOUBLE return value
+func (v CallValue) Double() float64 { return math.Float64frombits(uint64(v)) }
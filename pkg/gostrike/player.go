@@ -302,3 +302,45 @@ func (p *Player) SetArmor(armor int) {
 		pawn.SetPropInt("CCSPlayerPawnBase", "m_ArmorValue", int32(armor))
 	}
 }
+
+// ============================================================
+// Transmit Filtering
+// ============================================================
+
+func entityIndices(entities []*Entity) []uint32 {
+	indices := make([]uint32, 0, len(entities))
+	for _, e := range entities {
+		if e != nil && e.Index != 0 {
+			indices = append(indices, e.Index)
+		}
+	}
+	return indices
+}
+
+// HideEntities stops the given entities from being networked to this player.
+// The filter runs natively in CheckTransmit, so hidden entities cost nothing per tick in Go.
+// Every hidden set is cleared at map end.
+// Never hide the player's own pawn or controller.
+func (p *Player) HideEntities(entities ...*Entity) {
+	bridge.TransmitSetHidden(p.Slot, entityIndices(entities), true)
+}
+
+// UnhideEntities makes previously hidden entities visible to this player again
+func (p *Player) UnhideEntities(entities ...*Entity) {
+	bridge.TransmitSetHidden(p.Slot, entityIndices(entities), false)
+}
+
+// ClearHiddenEntities makes every entity visible to this player again
+func (p *Player) ClearHiddenEntities() {
+	bridge.TransmitClear(p.Slot)
+}
+
+// HideEntitiesFromAll stops the given entities from being networked to every player
+func HideEntitiesFromAll(entities ...*Entity) {
+	bridge.TransmitSetHidden(-1, entityIndices(entities), true)
+}
+
+// UnhideEntitiesFromAll makes the given entities visible to every player again
+func UnhideEntitiesFromAll(entities ...*Entity) {
+	bridge.TransmitSetHidden(-1, entityIndices(entities), false)
+}
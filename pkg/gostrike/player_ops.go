@@ -0,0 +1,117 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides batched player operations.
+package gostrike
+
+import (
+	"github.com/corrreia/gostrike/internal/bridge"
+)
+
+// PlayerBatch is a command buffer of player operations. Queue operations for
+// any number of players, then Submit runs them all in order in one native call.
+// Typical use is round-start setup:
+//
+//	batch := gostrike.NewPlayerBatch()
+//	for _, p := range players {
+//		batch.Respawn(p).Strip(p).Give(p, "ak47", "item_assaultsuit").SetHealth(p, 100)
+//	}
+//	batch.Submit()
+type PlayerBatch struct {
+	ops []bridge.PlayerOp
+}
+
+// NewPlayerBatch creates an empty player command buffer
+func NewPlayerBatch() *PlayerBatch {
+	return &PlayerBatch{}
+}
+
+func (b *PlayerBatch) push(p *Player, op bridge.PlayerOp) *PlayerBatch {
+	if p == nil {
+		return b
+	}
+	op.Slot = int32(p.Slot)
+	b.ops = append(b.ops, op)
+	return b
+}
+
+// Respawn queues a respawn
+func (b *PlayerBatch) Respawn(p *Player) *PlayerBatch {
+	return b.push(p, bridge.PlayerOp{Kind: bridge.PlayerOpRespawn})
+}
+
+// Teleport queues a teleport. Pass nil for any vector you don't want to change.
+func (b *PlayerBatch) Teleport(p *Player, pos, angles, velocity *Vector3) *PlayerBatch {
+	op := bridge.PlayerOp{Kind: bridge.PlayerOpTeleport}
+	if pos != nil {
+		op.Flags |= bridge.PlayerOpOrigin
+		op.Origin = toBridgeVec(*pos)
+	}
+	if angles != nil {
+		op.Flags |= bridge.PlayerOpAngles
+		op.Angles = toBridgeVec(*angles)
+	}
+	if velocity != nil {
+		op.Flags |= bridge.PlayerOpVelocity
+		op.Velocity = toBridgeVec(*velocity)
+	}
+	return b.push(p, op)
+}
+
+// SetHealth queues a health change
+func (b *PlayerBatch) SetHealth(p *Player, health int) *PlayerBatch {
+	return b.push(p, bridge.PlayerOp{Kind: bridge.PlayerOpSetHealth, Value: int32(health)})
+}
+
+// SetArmor queues an armor change
+func (b *PlayerBatch) SetArmor(p *Player, armor int) *PlayerBatch {
+	return b.push(p, bridge.PlayerOp{Kind: bridge.PlayerOpSetArmor, Value: int32(armor)})
+}
+
+// Strip queues removal of all weapons
+func (b *PlayerBatch) Strip(p *Player) *PlayerBatch {
+	return b.push(p, bridge.PlayerOp{Kind: bridge.PlayerOpStrip})
+}
+
+// Give queues one or more items, with or without the "weapon_" prefix
+func (b *PlayerBatch) Give(p *Player, items ...string) *PlayerBatch {
+	for _, item := range items {
+		if item != "" {
+			b.push(p, bridge.PlayerOp{Kind: bridge.PlayerOpGiveItem, Item: item})
+		}
+	}
+	return b
+}
+
+// GiveIDs queues registered items by ID (see LookupItem)
+func (b *PlayerBatch) GiveIDs(p *Player, ids ...ItemID) *PlayerBatch {
+	for _, id := range ids {
+		if id != ItemInvalid {
+			b.push(p, bridge.PlayerOp{Kind: bridge.PlayerOpGiveItem, Value: int32(id)})
+		}
+	}
+	return b
+}
+
+// SetTeam queues a team change
+func (b *PlayerBatch) SetTeam(p *Player, team Team) *PlayerBatch {
+	return b.push(p, bridge.PlayerOp{Kind: bridge.PlayerOpSetTeam, Value: int32(team)})
+}
+
+// Len returns the number of queued operations
+func (b *PlayerBatch) Len() int {
+	return len(b.ops)
+}
+
+// Reset discards all queued operations
+func (b *PlayerBatch) Reset() {
+	b.ops = b.ops[:0]
+}
+
+// Submit executes every queued operation in order and empties the batch.
+// Must be called from the game thread (event handlers, timers, NextFrame).
+// Returns the number of operations that were applied; operations for
+// disconnected players are skipped.
+func (b *PlayerBatch) Submit() int {
+	applied := bridge.SubmitPlayerOps(b.ops)
+	b.Reset()
+	return applied
+}
@@ -0,0 +1,151 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides batched engine ray traces.
+package gostrike
+
+import (
+	"errors"
+
+	"github.com/corrreia/gostrike/internal/bridge"
+)
+
+// ErrTraceUnavailable is returned when the server has no trace backend: the
+// TracePlayerBBox gamedata signature is missing or did not resolve.
+var ErrTraceUnavailable = errors.New("engine traces unavailable: TracePlayerBBox not resolved from gamedata")
+
+// TraceAvailable reports whether engine traces (and the visibility sweep) work
+// on this server.
+func TraceAvailable() bool {
+	return bridge.TraceAvailable()
+}
+
+// TraceMask selects which geometry a trace collides with (CS2 interaction layers)
+type TraceMask uint64
+
+const (
+	TraceContentsSolid         TraceMask = TraceMask(bridge.TraceContentsSolid)
+	TraceContentsHitbox        TraceMask = TraceMask(bridge.TraceContentsHitbox)
+	TraceContentsTrigger       TraceMask = TraceMask(bridge.TraceContentsTrigger)
+	TraceContentsSky           TraceMask = TraceMask(bridge.TraceContentsSky)
+	TraceContentsPlayerClip    TraceMask = TraceMask(bridge.TraceContentsPlayerClip)
+	TraceContentsBlockLOS      TraceMask = TraceMask(bridge.TraceContentsBlockLOS)
+	TraceContentsWindow        TraceMask = TraceMask(bridge.TraceContentsWindow)
+	TraceContentsWorldGeometry TraceMask = TraceMask(bridge.TraceContentsWorldGeometry)
+	TraceContentsWater         TraceMask = TraceMask(bridge.TraceContentsWater)
+	TraceContentsPlayer        TraceMask = TraceMask(bridge.TraceContentsPlayer)
+	TraceContentsNPC           TraceMask = TraceMask(bridge.TraceContentsNPC)
+	TraceContentsDebris        TraceMask = TraceMask(bridge.TraceContentsDebris)
+	TraceContentsPhysicsProp   TraceMask = TraceMask(bridge.TraceContentsPhysicsProp)
+
+	// TraceMaskWorld hits static world geometry only
+	TraceMaskWorld = TraceContentsSolid | TraceContentsWorldGeometry
+	// TraceMaskVisibility hits everything that blocks line of sight
+	TraceMaskVisibility = TraceContentsSolid | TraceContentsBlockLOS | TraceContentsWorldGeometry
+	// TraceMaskShot hits world, props and player hitboxes
+	TraceMaskShot = TraceMaskWorld | TraceContentsWindow | TraceContentsHitbox | TraceContentsPhysicsProp | TraceContentsDebris
+)
+
+// Ray describes one trace. Leave Mins/Maxs zero for a line trace.
+type Ray struct {
+	Start  Vector3
+	End    Vector3
+	Mins   Vector3
+	Maxs   Vector3
+	Ignore *Entity // entity to pass through, nil for none
+}
+
+// TraceResult is the outcome of one traced ray
+type TraceResult struct {
+	Hit        bool
+	StartSolid bool
+	Fraction   float32 // 0..1 along Start -> End
+	End        Vector3
+	Normal     Vector3
+	Entity     *Entity // nil for world hits or no hit
+}
+
+func toBridgeVec(v Vector3) [3]float32 {
+	return [3]float32{float32(v.X), float32(v.Y), float32(v.Z)}
+}
+
+func fromBridgeVec(v [3]float32) Vector3 {
+	return Vector3{X: float64(v[0]), Y: float64(v[1]), Z: float64(v[2])}
+}
+
+func traceBatch(rays []Ray, mask TraceMask, flags uint32) ([]TraceResult, int, error) {
+	if !bridge.TraceAvailable() {
+		return nil, 0, ErrTraceUnavailable
+	}
+	if len(rays) == 0 {
+		return nil, 0, nil
+	}
+
+	bridgeRays := make([]bridge.Ray, len(rays))
+	for i, ray := range rays {
+		bridgeRays[i] = bridge.Ray{
+			Start:  toBridgeVec(ray.Start),
+			End:    toBridgeVec(ray.End),
+			Mins:   toBridgeVec(ray.Mins),
+			Maxs:   toBridgeVec(ray.Maxs),
+			Ignore: entityHandleOrInvalid(ray.Ignore),
+		}
+	}
+
+	bridgeResults, hits := bridge.TraceBatch(bridgeRays, uint64(mask), flags)
+	results := make([]TraceResult, len(bridgeResults))
+	for i, r := range bridgeResults {
+		results[i] = TraceResult{
+			Hit:        r.Hit,
+			StartSolid: r.StartSolid,
+			Fraction:   r.Fraction,
+			End:        fromBridgeVec(r.End),
+			Normal:     fromBridgeVec(r.Normal),
+		}
+		if r.Entity.Ptr != 0 {
+			results[i].Entity = &Entity{
+				Index:     r.Entity.Index,
+				ClassName: r.Entity.ClassName,
+				ptr:       r.Entity.Ptr,
+				handle:    r.Entity.Handle,
+			}
+		}
+	}
+	return results, hits, nil
+}
+
+// TraceBatch traces every ray in a single native call and returns one result per ray.
+// Consecutive rays that ignore the same entity share a native trace filter.
+// Returns ErrTraceUnavailable when the server has no trace backend.
+// Must be called from the game thread.
+func TraceBatch(rays []Ray, mask TraceMask) ([]TraceResult, error) {
+	results, _, err := traceBatch(rays, mask, 0)
+	return results, err
+}
+
+// TraceAnyHit reports whether any of the rays hits, stopping at the first hit.
+// Returns the index of the first ray that hit, or -1.
+// Returns ErrTraceUnavailable when the server has no trace backend.
+func TraceAnyHit(rays []Ray, mask TraceMask) (int, error) {
+	results, hits, err := traceBatch(rays, mask, bridge.TraceAnyHit)
+	if err != nil || hits == 0 {
+		return -1, err
+	}
+	for i, r := range results {
+		if r.Hit {
+			return i, nil
+		}
+	}
+	return -1, nil
+}
+
+// TraceLine traces a single line from start to end.
+// Returns ErrTraceUnavailable when the server has no trace backend.
+func TraceLine(start, end Vector3, mask TraceMask, ignore *Entity) (TraceResult, error) {
+	results, _, err := traceBatch([]Ray{{Start: start, End: end, Ignore: ignore}}, mask, 0)
+	if err != nil {
+		return TraceResult{}, err
+	}
+	if len(results) == 0 {
+		return TraceResult{Fraction: 1, End: end}, nil
+	}
+	return results[0], nil
+}
@@ -0,0 +1,76 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides the native line-of-sight visibility matrix.
+package gostrike
+
+import (
+	"github.com/corrreia/gostrike/internal/bridge"
+)
+
+// VisibilityConfig configures the native line-of-sight sweep.
+// The sweep is disabled until ConfigureVisibility is called with IntervalTicks > 0.
+//
+// FOVDegrees only affects the matrix. TransmitHideEnemies uses distance and
+// line of sight, padded for the matrix's age: an enemy is still networked if
+// they would be visible at their extrapolated position, and for one more
+// sweep after they were last visible.
+type VisibilityConfig struct {
+	IntervalTicks       int     // start a new sweep every N ticks
+	BudgetMicros        int     // trace time budget per tick (default 500µs)
+	MaxDistance         float32 // pairs farther apart are never visible, 0 = unlimited
+	FOVDegrees          float32 // view cone for frustum culling of the matrix, 0 = disabled
+	TransmitHideEnemies bool    // stop networking enemy pawns a player cannot see (anti-wallhack)
+}
+
+// VisibilityMatrix is a snapshot of the 64x64 player visibility bitmask.
+// Bit j of row i is set if the player in slot i can see the player in slot j.
+type VisibilityMatrix struct {
+	Rows       [64]uint64
+	Generation int // increments with every completed sweep, 0 = none yet
+}
+
+// ConfigureVisibility enables or reconfigures the native line-of-sight sweep.
+// Sweeps need engine traces; without them ErrTraceUnavailable is returned and
+// no matrix is ever published (the configuration is still stored).
+func ConfigureVisibility(cfg VisibilityConfig) error {
+	bridge.ConfigureVisibility(bridge.VisibilityConfig{
+		IntervalTicks:       cfg.IntervalTicks,
+		BudgetMicros:        cfg.BudgetMicros,
+		MaxDistance:         cfg.MaxDistance,
+		FOVDegrees:          cfg.FOVDegrees,
+		TransmitHideEnemies: cfg.TransmitHideEnemies,
+	})
+	if cfg.IntervalTicks > 0 && !TraceAvailable() {
+		return ErrTraceUnavailable
+	}
+	return nil
+}
+
+// GetVisibilityMatrix returns the last completed visibility matrix in a single native call.
+// Fetch it once per tick and query it with CanSee rather than calling per pair.
+func GetVisibilityMatrix() *VisibilityMatrix {
+	m := &VisibilityMatrix{}
+	m.Generation = bridge.GetVisibilityMatrix(&m.Rows)
+	return m
+}
+
+// CanSee reports whether the player in viewer slot can see the player in target slot.
+func (m *VisibilityMatrix) CanSee(viewer, target int) bool {
+	if viewer < 0 || viewer >= 64 || target < 0 || target >= 64 {
+		return false
+	}
+	return m.Rows[viewer]&(1<<uint(target)) != 0
+}
+
+// VisibleTo returns the slots visible to the viewer slot.
+func (m *VisibilityMatrix) VisibleTo(viewer int) []int {
+	if viewer < 0 || viewer >= 64 {
+		return nil
+	}
+	var slots []int
+	for row, j := m.Rows[viewer], 0; row != 0; row, j = row>>1, j+1 {
+		if row&1 != 0 {
+			slots = append(slots, j)
+		}
+	}
+	return slots
+}
@@ -0,0 +1,99 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides dirty-tracked entity property watchers.
+package gostrike
+
+import (
+	"encoding/binary"
+	"fmt"
+	"math"
+
+	"github.com/corrreia/gostrike/internal/bridge"
+	"github.com/corrreia/gostrike/internal/runtime"
+)
+
+// PropertyWatch is a live subscription to changes of one entity field.
+// Fields are compared natively every frame; the handler only runs on frames
+// where the value actually changed. A watch ends on Remove, when the entity
+// is deleted or when the map ends.
+type PropertyWatch struct {
+	id     int
+	active bool
+}
+
+// Active reports whether the watch is still registered
+func (w *PropertyWatch) Active() bool {
+	return w != nil && w.active
+}
+
+// Remove stops the watch. Safe to call more than once.
+func (w *PropertyWatch) Remove() {
+	if !w.Active() {
+		return
+	}
+	w.active = false
+	runtime.UnregisterWatchHandler(w.id)
+	bridge.WatchRemove(int32(w.id))
+}
+
+// WatchRaw watches size bytes (1-16) of a schema field. fn receives the old
+// and new raw bytes; they are only valid during the call.
+func (e *Entity) WatchRaw(className, fieldName string, size int, fn func(old, new []byte)) (*PropertyWatch, error) {
+	if size <= 0 || size > bridge.WatchValueSize {
+		return nil, fmt.Errorf("watch %s::%s: size %d out of range 1-%d", className, fieldName, size, bridge.WatchValueSize)
+	}
+	handle := e.Handle()
+	if handle == 0 {
+		return nil, fmt.Errorf("watch %s::%s: entity is not valid", className, fieldName)
+	}
+	id := bridge.WatchAdd(handle, className, fieldName, size)
+	if id < 0 {
+		return nil, fmt.Errorf("watch %s::%s: native registration failed (see server console)", className, fieldName)
+	}
+
+	w := &PropertyWatch{id: int(id), active: true}
+	runtime.RegisterWatchHandler(w.id, func(c *runtime.WatchChange) {
+		if c.Removed {
+			w.active = false
+			return
+		}
+		fn(c.Old[:size], c.New[:size])
+	})
+	return w, nil
+}
+
+// WatchInt watches an int32 field
+func (e *Entity) WatchInt(className, fieldName string, fn func(old, new int32)) (*PropertyWatch, error) {
+	return e.WatchRaw(className, fieldName, 4, func(o, n []byte) {
+		fn(int32(binary.LittleEndian.Uint32(o)), int32(binary.LittleEndian.Uint32(n)))
+	})
+}
+
+// WatchFloat watches a float32 field
+func (e *Entity) WatchFloat(className, fieldName string, fn func(old, new float32)) (*PropertyWatch, error) {
+	return e.WatchRaw(className, fieldName, 4, func(o, n []byte) {
+		fn(math.Float32frombits(binary.LittleEndian.Uint32(o)), math.Float32frombits(binary.LittleEndian.Uint32(n)))
+	})
+}
+
+// WatchBool watches a bool field
+func (e *Entity) WatchBool(className, fieldName string, fn func(old, new bool)) (*PropertyWatch, error) {
+	return e.WatchRaw(className, fieldName, 1, func(o, n []byte) {
+		fn(o[0] != 0, n[0] != 0)
+	})
+}
+
+// WatchVector watches a Vector/QAngle field
+func (e *Entity) WatchVector(className, fieldName string, fn func(old, new Vector3)) (*PropertyWatch, error) {
+	return e.WatchRaw(className, fieldName, 12, func(o, n []byte) {
+		fn(decodeVector3(o), decodeVector3(n))
+	})
+}
+
+// decodeVector3 decodes three little-endian float32s
+func decodeVector3(b []byte) Vector3 {
+	return Vector3{
+		X: float64(math.Float32frombits(binary.LittleEndian.Uint32(b[0:]))),
+		Y: float64(math.Float32frombits(binary.LittleEndian.Uint32(b[4:]))),
+		Z: float64(math.Float32frombits(binary.LittleEndian.Uint32(b[8:]))),
+	}
+}
@@ -0,0 +1,153 @@
+// Package gostrike provides the public SDK for GoStrike plugins.
+// This file provides the weapon/item registry.
+package gostrike
+
+import (
+	"strings"
+	"sync"
+
+	"github.com/corrreia/gostrike/internal/bridge"
+	"github.com/corrreia/gostrike/internal/runtime"
+)
+
+// ItemID is a compact weapon/item identifier from the native registry.
+// IDs are stable for the lifetime of the server process.
+type ItemID int32
+
+// ItemInvalid is returned for unknown item names
+const ItemInvalid ItemID = ItemID(bridge.ItemInvalid)
+
+// WeaponInfo describes a registered weapon or item.
+// Weapon data fields are zero until the game's item data has loaded
+// (and always zero for equipment such as item_kevlar).
+type WeaponInfo struct {
+	ID          ItemID
+	DefIndex    int
+	ClassName   string // "weapon_ak47"
+	Price       int
+	KillAward   int
+	MaxClip     int
+	ReserveAmmo int
+	GearSlot    int
+	WeaponType  int
+	HasData     bool
+}
+
+var weaponRegistry struct {
+	mu       sync.RWMutex
+	infos    []WeaponInfo
+	byName   map[string]ItemID
+	loaded   bool   // fetched for a data query
+	complete bool   // every weapon had data when last fetched
+	mapGen   uint64 // map generation of the last fetch
+}
+
+// weaponList is the native registry source (replaced in tests)
+var weaponList = bridge.WeaponList
+
+// loadWeapons fetches the registry once for names, and once more on the first
+// data query. Weapons without data are not retried per call: the fetch is
+// repeated only after a map start, when the game's item data may have loaded.
+func loadWeapons(needData bool) {
+	mapGen := runtime.MapGeneration()
+	weaponRegistry.mu.RLock()
+	done := weaponRegistry.infos != nil && (!needData ||
+		(weaponRegistry.loaded && (weaponRegistry.complete || weaponRegistry.mapGen == mapGen)))
+	weaponRegistry.mu.RUnlock()
+	if done {
+		return
+	}
+
+	raw := weaponList()
+	if len(raw) == 0 {
+		return
+	}
+
+	infos := make([]WeaponInfo, len(raw))
+	byName := make(map[string]ItemID, len(raw)*2)
+	complete := true
+	for i, w := range raw {
+		infos[i] = WeaponInfo{
+			ID:          ItemID(w.ItemID),
+			DefIndex:    int(w.DefIndex),
+			ClassName:   w.ClassName,
+			Price:       int(w.Price),
+			KillAward:   int(w.KillAward),
+			MaxClip:     int(w.MaxClip1),
+			ReserveAmmo: int(w.ReserveAmmo),
+			GearSlot:    int(w.GearSlot),
+			WeaponType:  int(w.WeaponType),
+			HasData:     w.VData != 0,
+		}
+		byName[w.ClassName] = ItemID(w.ItemID)
+		// Equipment never has weapon data; only weapons gate completeness
+		if short, ok := strings.CutPrefix(w.ClassName, "weapon_"); ok {
+			byName[short] = ItemID(w.ItemID)
+			if !infos[i].HasData {
+				complete = false
+			}
+		}
+	}
+
+	weaponRegistry.mu.Lock()
+	weaponRegistry.infos = infos
+	weaponRegistry.byName = byName
+	weaponRegistry.loaded = weaponRegistry.loaded || needData
+	weaponRegistry.complete = complete
+	weaponRegistry.mapGen = mapGen
+	weaponRegistry.mu.Unlock()
+}
+
+// LookupItem returns the item ID for a name ("ak47", "weapon_ak47", "item_kevlar"),
+// or ItemInvalid if the item is unknown.
+func LookupItem(name string) ItemID {
+	loadWeapons(false)
+	weaponRegistry.mu.RLock()
+	defer weaponRegistry.mu.RUnlock()
+	if id, ok := weaponRegistry.byName[name]; ok {
+		return id
+	}
+	return ItemInvalid
+}
+
+// GetWeaponInfo returns the registry entry for an item ID
+func GetWeaponInfo(id ItemID) (WeaponInfo, bool) {
+	loadWeapons(true)
+	weaponRegistry.mu.RLock()
+	defer weaponRegistry.mu.RUnlock()
+	if id < 0 || int(id) >= len(weaponRegistry.infos) {
+		return WeaponInfo{}, false
+	}
+	return weaponRegistry.infos[id], true
+}
+
+// GetWeapons returns every registered weapon and item
+func GetWeapons() []WeaponInfo {
+	loadWeapons(true)
+	weaponRegistry.mu.RLock()
+	defer weaponRegistry.mu.RUnlock()
+	return append([]WeaponInfo(nil), weaponRegistry.infos...)
+}
+
+// Name returns the item's classname, or "" for an unknown ID
+func (id ItemID) Name() string {
+	loadWeapons(false)
+	weaponRegistry.mu.RLock()
+	defer weaponRegistry.mu.RUnlock()
+	if id < 0 || int(id) >= len(weaponRegistry.infos) {
+		return ""
+	}
+	return weaponRegistry.infos[id].ClassName
+}
+
+// GiveItems gives registered items to this player in one call.
+// Returns the number of items given.
+func (p *Player) GiveItems(ids ...ItemID) int {
+	raw := make([]int32, 0, len(ids))
+	for _, id := range ids {
+		if id != ItemInvalid {
+			raw = append(raw, int32(id))
+		}
+	}
+	return bridge.GiveItems(p.Slot, raw)
+}
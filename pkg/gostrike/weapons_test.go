@@ -0,0 +1,103 @@
+package gostrike
+
+import (
+	"testing"
+
+	"github.com/corrreia/gostrike/internal/bridge"
+	"github.com/corrreia/gostrike/internal/runtime"
+)
+
+// fakeWeaponList serves a two-item registry and counts native fetches
+type fakeWeaponList struct {
+	calls   int
+	hasData bool
+}
+
+func (f *fakeWeaponList) list() []bridge.WeaponInfo {
+	f.calls++
+	ak := bridge.WeaponInfo{ItemID: 0, DefIndex: 7, ClassName: "weapon_ak47"}
+	if f.hasData {
+		ak.VData = 1
+		ak.Price = 2700
+	}
+	return []bridge.WeaponInfo{ak, {ItemID: 1, DefIndex: 50, ClassName: "item_kevlar"}}
+}
+
+// installWeaponList resets the cached registry and routes fetches to a fake
+func installWeaponList(t *testing.T) *fakeWeaponList {
+	t.Helper()
+	f := &fakeWeaponList{}
+	reset := func() {
+		weaponRegistry.mu.Lock()
+		weaponRegistry.infos = nil
+		weaponRegistry.byName = nil
+		weaponRegistry.loaded = false
+		weaponRegistry.complete = false
+		weaponRegistry.mapGen = 0
+		weaponRegistry.mu.Unlock()
+	}
+	reset()
+	weaponList = f.list
+	t.Cleanup(func() {
+		weaponList = bridge.WeaponList
+		reset()
+	})
+	return f
+}
+
+// ── weapon registry tests ─────────────────────────────────────
+
+func TestLoadWeaponsNamesFetchedOnce(t *testing.T) {
+	f := installWeaponList(t)
+
+	for i := 0; i < 3; i++ {
+		if id := LookupItem("ak47"); id != 0 {
+			t.Fatalf("LookupItem(ak47) = %d, want 0", id)
+		}
+	}
+	if f.calls != 1 {
+		t.Fatalf("native fetches for name lookups = %d, want 1", f.calls)
+	}
+}
+
+func TestLoadWeaponsCachesMissingDataUntilMapStart(t *testing.T) {
+	f := installWeaponList(t)
+
+	for i := 0; i < 3; i++ {
+		if info, ok := GetWeaponInfo(0); !ok || info.HasData {
+			t.Fatalf("GetWeaponInfo(0) = %+v, %v before data loaded", info, ok)
+		}
+	}
+	if f.calls != 1 {
+		t.Fatalf("native fetches with missing data = %d, want 1", f.calls)
+	}
+
+	f.hasData = true
+	runtime.DispatchMapChange("de_dust2")
+	info, _ := GetWeaponInfo(0)
+	if !info.HasData || info.Price != 2700 {
+		t.Fatalf("GetWeaponInfo(0) after map start = %+v, want data", info)
+	}
+	if f.calls != 2 {
+		t.Fatalf("native fetches after map start = %d, want 2", f.calls)
+	}
+
+	// Complete data is never fetched again, even across maps
+	runtime.DispatchMapChange("de_inferno")
+	GetWeapons()
+	if f.calls != 2 {
+		t.Fatalf("native fetches with complete data = %d, want 2", f.calls)
+	}
+}
+
+func TestLoadWeaponsEquipmentDoesNotGateCompleteness(t *testing.T) {
+	f := installWeaponList(t)
+	f.hasData = true
+
+	GetWeapons()
+	runtime.DispatchMapChange("de_mirage")
+	GetWeapons()
+	if f.calls != 1 {
+		t.Fatalf("native fetches = %d, want 1 (item_kevlar never has data)", f.calls)
+	}
+}